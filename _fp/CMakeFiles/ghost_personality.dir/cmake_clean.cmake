@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ghost_personality.dir/bench/ghost-personality.cpp.o"
+  "CMakeFiles/ghost_personality.dir/bench/ghost-personality.cpp.o.d"
+  "ghost_personality"
+  "ghost_personality.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ghost_personality.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
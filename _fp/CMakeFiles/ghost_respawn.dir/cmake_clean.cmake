@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ghost_respawn.dir/bench/ghost-respawn.cpp.o"
+  "CMakeFiles/ghost_respawn.dir/bench/ghost-respawn.cpp.o.d"
+  "ghost_respawn"
+  "ghost_respawn.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ghost_respawn.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
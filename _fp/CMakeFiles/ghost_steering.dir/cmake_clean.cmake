@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ghost_steering.dir/bench/ghost-steering.cpp.o"
+  "CMakeFiles/ghost_steering.dir/bench/ghost-steering.cpp.o.d"
+  "ghost_steering"
+  "ghost_steering.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ghost_steering.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
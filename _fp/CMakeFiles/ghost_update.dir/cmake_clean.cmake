@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ghost_update.dir/bench/ghost-update.cpp.o"
+  "CMakeFiles/ghost_update.dir/bench/ghost-update.cpp.o.d"
+  "ghost_update"
+  "ghost_update.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ghost_update.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
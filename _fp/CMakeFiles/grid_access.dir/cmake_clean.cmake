@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/grid_access.dir/bench/grid-access.cpp.o"
+  "CMakeFiles/grid_access.dir/bench/grid-access.cpp.o.d"
+  "grid_access"
+  "grid_access.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/grid_access.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/large_step.dir/bench/large-step.cpp.o"
+  "CMakeFiles/large_step.dir/bench/large-step.cpp.o.d"
+  "large_step"
+  "large_step.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/large_step.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/maze_distance.dir/bench/maze-distance.cpp.o"
+  "CMakeFiles/maze_distance.dir/bench/maze-distance.cpp.o.d"
+  "maze_distance"
+  "maze_distance.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/maze_distance.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
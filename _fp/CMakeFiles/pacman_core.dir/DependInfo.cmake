@@ -0,0 +1,35 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/batch-simulation.cpp" "CMakeFiles/pacman_core.dir/src/batch-simulation.cpp.o" "gcc" "CMakeFiles/pacman_core.dir/src/batch-simulation.cpp.o.d"
+  "/root/repo/src/fixed-timestep.cpp" "CMakeFiles/pacman_core.dir/src/fixed-timestep.cpp.o" "gcc" "CMakeFiles/pacman_core.dir/src/fixed-timestep.cpp.o.d"
+  "/root/repo/src/game-context.cpp" "CMakeFiles/pacman_core.dir/src/game-context.cpp.o" "gcc" "CMakeFiles/pacman_core.dir/src/game-context.cpp.o.d"
+  "/root/repo/src/ghost-steering.cpp" "CMakeFiles/pacman_core.dir/src/ghost-steering.cpp.o" "gcc" "CMakeFiles/pacman_core.dir/src/ghost-steering.cpp.o.d"
+  "/root/repo/src/ghost.cpp" "CMakeFiles/pacman_core.dir/src/ghost.cpp.o" "gcc" "CMakeFiles/pacman_core.dir/src/ghost.cpp.o.d"
+  "/root/repo/src/grid.cpp" "CMakeFiles/pacman_core.dir/src/grid.cpp.o" "gcc" "CMakeFiles/pacman_core.dir/src/grid.cpp.o.d"
+  "/root/repo/src/level-pack.cpp" "CMakeFiles/pacman_core.dir/src/level-pack.cpp.o" "gcc" "CMakeFiles/pacman_core.dir/src/level-pack.cpp.o.d"
+  "/root/repo/src/mapped-file.cpp" "CMakeFiles/pacman_core.dir/src/mapped-file.cpp.o" "gcc" "CMakeFiles/pacman_core.dir/src/mapped-file.cpp.o.d"
+  "/root/repo/src/maze-graph.cpp" "CMakeFiles/pacman_core.dir/src/maze-graph.cpp.o" "gcc" "CMakeFiles/pacman_core.dir/src/maze-graph.cpp.o.d"
+  "/root/repo/src/movement.cpp" "CMakeFiles/pacman_core.dir/src/movement.cpp.o" "gcc" "CMakeFiles/pacman_core.dir/src/movement.cpp.o.d"
+  "/root/repo/src/observation-encoder.cpp" "CMakeFiles/pacman_core.dir/src/observation-encoder.cpp.o" "gcc" "CMakeFiles/pacman_core.dir/src/observation-encoder.cpp.o.d"
+  "/root/repo/src/pacman.cpp" "CMakeFiles/pacman_core.dir/src/pacman.cpp.o" "gcc" "CMakeFiles/pacman_core.dir/src/pacman.cpp.o.d"
+  "/root/repo/src/replay.cpp" "CMakeFiles/pacman_core.dir/src/replay.cpp.o" "gcc" "CMakeFiles/pacman_core.dir/src/replay.cpp.o.d"
+  "/root/repo/src/simulation.cpp" "CMakeFiles/pacman_core.dir/src/simulation.cpp.o" "gcc" "CMakeFiles/pacman_core.dir/src/simulation.cpp.o.d"
+  "/root/repo/src/vector-env.cpp" "CMakeFiles/pacman_core.dir/src/vector-env.cpp.o" "gcc" "CMakeFiles/pacman_core.dir/src/vector-env.cpp.o.d"
+  "/root/repo/src/vector2.cpp" "CMakeFiles/pacman_core.dir/src/vector2.cpp.o" "gcc" "CMakeFiles/pacman_core.dir/src/vector2.cpp.o.d"
+  "/root/repo/src/work-stealing-pool.cpp" "CMakeFiles/pacman_core.dir/src/work-stealing-pool.cpp.o" "gcc" "CMakeFiles/pacman_core.dir/src/work-stealing-pool.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,43 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pacman_core.dir/src/batch-simulation.cpp.o"
+  "CMakeFiles/pacman_core.dir/src/batch-simulation.cpp.o.d"
+  "CMakeFiles/pacman_core.dir/src/fixed-timestep.cpp.o"
+  "CMakeFiles/pacman_core.dir/src/fixed-timestep.cpp.o.d"
+  "CMakeFiles/pacman_core.dir/src/game-context.cpp.o"
+  "CMakeFiles/pacman_core.dir/src/game-context.cpp.o.d"
+  "CMakeFiles/pacman_core.dir/src/ghost-steering.cpp.o"
+  "CMakeFiles/pacman_core.dir/src/ghost-steering.cpp.o.d"
+  "CMakeFiles/pacman_core.dir/src/ghost.cpp.o"
+  "CMakeFiles/pacman_core.dir/src/ghost.cpp.o.d"
+  "CMakeFiles/pacman_core.dir/src/grid.cpp.o"
+  "CMakeFiles/pacman_core.dir/src/grid.cpp.o.d"
+  "CMakeFiles/pacman_core.dir/src/level-pack.cpp.o"
+  "CMakeFiles/pacman_core.dir/src/level-pack.cpp.o.d"
+  "CMakeFiles/pacman_core.dir/src/mapped-file.cpp.o"
+  "CMakeFiles/pacman_core.dir/src/mapped-file.cpp.o.d"
+  "CMakeFiles/pacman_core.dir/src/maze-graph.cpp.o"
+  "CMakeFiles/pacman_core.dir/src/maze-graph.cpp.o.d"
+  "CMakeFiles/pacman_core.dir/src/movement.cpp.o"
+  "CMakeFiles/pacman_core.dir/src/movement.cpp.o.d"
+  "CMakeFiles/pacman_core.dir/src/observation-encoder.cpp.o"
+  "CMakeFiles/pacman_core.dir/src/observation-encoder.cpp.o.d"
+  "CMakeFiles/pacman_core.dir/src/pacman.cpp.o"
+  "CMakeFiles/pacman_core.dir/src/pacman.cpp.o.d"
+  "CMakeFiles/pacman_core.dir/src/replay.cpp.o"
+  "CMakeFiles/pacman_core.dir/src/replay.cpp.o.d"
+  "CMakeFiles/pacman_core.dir/src/simulation.cpp.o"
+  "CMakeFiles/pacman_core.dir/src/simulation.cpp.o.d"
+  "CMakeFiles/pacman_core.dir/src/vector-env.cpp.o"
+  "CMakeFiles/pacman_core.dir/src/vector-env.cpp.o.d"
+  "CMakeFiles/pacman_core.dir/src/vector2.cpp.o"
+  "CMakeFiles/pacman_core.dir/src/vector2.cpp.o.d"
+  "CMakeFiles/pacman_core.dir/src/work-stealing-pool.cpp.o"
+  "CMakeFiles/pacman_core.dir/src/work-stealing-pool.cpp.o.d"
+  "libpacman_core.a"
+  "libpacman_core.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pacman_core.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libpacman_core.a"
+)
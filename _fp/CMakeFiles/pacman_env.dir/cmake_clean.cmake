@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pacman_env.dir/src/pacman-env.cpp.o"
+  "CMakeFiles/pacman_env.dir/src/pacman-env.cpp.o.d"
+  "libpacman_env.pdb"
+  "libpacman_env.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pacman_env.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pacman_headless.dir/src/headless.cpp.o"
+  "CMakeFiles/pacman_headless.dir/src/headless.cpp.o.d"
+  "pacman_headless"
+  "pacman_headless.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pacman_headless.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
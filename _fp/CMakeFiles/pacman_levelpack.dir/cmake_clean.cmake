@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pacman_levelpack.dir/src/level-pack-tool.cpp.o"
+  "CMakeFiles/pacman_levelpack.dir/src/level-pack-tool.cpp.o.d"
+  "pacman_levelpack"
+  "pacman_levelpack.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pacman_levelpack.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
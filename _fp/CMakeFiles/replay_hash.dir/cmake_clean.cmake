@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/replay_hash.dir/bench/replay-hash.cpp.o"
+  "CMakeFiles/replay_hash.dir/bench/replay-hash.cpp.o.d"
+  "replay_hash"
+  "replay_hash.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/replay_hash.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,14 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_fp
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(ghost_update_allocations "/root/repo/_fp/ghost_update" "--updates" "10000")
+set_tests_properties(ghost_update_allocations PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;163;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(ghost_respawn_home "/root/repo/_fp/ghost_respawn")
+set_tests_properties(ghost_respawn_home PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;177;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(large_step_matches_reference "/root/repo/_fp/large_step" "--games" "20")
+set_tests_properties(large_step_matches_reference PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;183;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(fixed_point_replay_hash "/root/repo/_fp/replay_hash" "--replay" "/root/repo/_fp/replay-hash.rpl")
+set_tests_properties(fixed_point_replay_hash PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;206;add_test;/root/repo/CMakeLists.txt;0;")
@@ -0,0 +1,44 @@
+// Generated by CMake from assets/maze.txt. Do not edit; edit the maze instead.
+#ifndef EMBEDDED_MAZE_H
+#define EMBEDDED_MAZE_H
+
+#include <string_view>
+
+inline constexpr std::string_view kEmbeddedMazeText = R"maze(                            
+                            
+                            
+############################
+#............##............#
+#.####.#####.##.#####.####.#
+#*#  #.#   #.##.#   #.#  #*#
+#.####.#####.##.#####.####.#
+#..........................#
+#.####.##.########.##.####.#
+#.####.##.########.##.####.#
+#......##....##....##......#
+######.##### ## #####.######
+     #.##### ## #####.#     
+     #.##          ##.#     
+     #.## ###--### ##.#     
+######.## #      # ##.######
+      .   #      #   .      
+######.## #      # ##.######
+     #.## ######## ##.#     
+     #.##          ##.#     
+     #.## ######## ##.#     
+######.## ######## ##.######
+#............##............#
+#.####.#####.##.#####.####.#
+#.####.#####.##.#####.####.#
+#*..##.......  .......##..*#
+###.##.##.########.##.##.###
+###.##.##.########.##.##.###
+#......##....##....##......#
+#.##########.##.##########.#
+#.##########.##.##########.#
+#..........................#
+############################
+                            
+                            )maze";
+
+#endif
@@ -0,0 +1,74 @@
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "batch-simulation.h"
+#include "constants.h"
+
+/**
+ * Measures BatchSimulation throughput (game ticks per second) at increasing
+ * thread counts and reports the speedup over a single thread.
+ *
+ * Usage: batch_throughput [--games N] [--ticks N]
+ */
+auto main(int argc, char *argv[]) -> int {
+  std::size_t games = 4096;
+  int ticks = 600;
+
+  for (int i = 1; i + 1 < argc; i += 2) {
+    std::string_view arg{argv[i]};
+    if (arg == "--games") {
+      games = std::strtoul(argv[i + 1], nullptr, 10);
+    } else if (arg == "--ticks") {
+      ticks = std::atoi(argv[i + 1]);
+    }
+  }
+
+  const auto hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+  std::vector<std::size_t> threadCounts;
+  for (std::size_t threads = 1; threads < hardwareThreads; threads *= 2) {
+    threadCounts.push_back(threads);
+  }
+  threadCounts.push_back(hardwareThreads);
+
+  // Same input stream for every run so each thread count does identical work
+  std::mt19937 rng{1};
+  std::uniform_int_distribution<int> direction{1, 4};
+  std::vector<Direction> inputs(games * ticks);
+  for (auto &input : inputs) {
+    input = static_cast<Direction>(direction(rng));
+  }
+
+  constexpr float kDeltaTime = 1.0f / kFramesPerSecond;
+  double baseline = 0.0;
+
+  std::cout << "games: " << games << ", ticks per game: " << ticks << "\n\n";
+  std::cout << std::setw(8) << "threads" << std::setw(16) << "ticks/s" << std::setw(10) << "speedup" << std::setw(12)
+            << "efficiency" << "\n";
+
+  for (auto threads : threadCounts) {
+    BatchSimulation batch{games, threads};
+
+    auto start = std::chrono::steady_clock::now();
+    for (int tick = 0; tick < ticks; ++tick) {
+      batch.Step(std::span<const Direction>{inputs.data() + tick * games, games}, kDeltaTime);
+    }
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    auto rate = static_cast<double>(games) * ticks / elapsed;
+    if (baseline == 0.0) {
+      baseline = rate;
+    }
+
+    std::cout << std::setw(8) << batch.Threads() << std::setw(16) << std::fixed << std::setprecision(0) << rate
+              << std::setw(9) << std::setprecision(2) << rate / baseline << "x" << std::setw(11)
+              << std::setprecision(0) << 100.0 * rate / baseline / batch.Threads() << "%\n";
+  }
+
+  return 0;
+}
@@ -0,0 +1,116 @@
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string_view>
+
+#include "default-maze.h"
+#include "ghost.h"
+
+namespace {
+
+/// The design GhostPersonality replaced: each ghost held a pointer to its
+/// targeting function, set from a virtual GhostConfig, and called it every frame.
+using Targeter = Vec2 (*)(Ghost &me, Pacman &pacman, Ghost &blinky, GhostMode mode);
+
+template <GhostPersonality Personality>
+auto targetAs(Ghost &me, Pacman &pacman, Ghost &blinky, GhostMode mode) -> Vec2 {
+  if (mode == GhostMode::kScatter || mode == GhostMode::kScared) {
+    return me.GetScatterCell();
+  }
+  return Personality::ChaseTarget(me, pacman, blinky);
+}
+
+constexpr std::array<Targeter, GhostPersonalities::kSize> kTargeters{
+    targetAs<BlinkyPersonality>, targetAs<InkyPersonality>, targetAs<PinkyPersonality>, targetAs<ClydePersonality>};
+
+} // namespace
+
+/**
+ * Times one chase-mode ghost step three ways: through a per-ghost Targeter
+ * function pointer (the former design), through GhostPersonalities::Visit with
+ * the personality's ChaseTarget inlined, and as a full Ghost::Update. All four
+ * ghosts start out of the pen, past the last scatter wave. Exits with status 1
+ * if the three runs leave the ghosts in different places.
+ *
+ * Usage: ghost_personality [--ticks N]
+ */
+auto main(int argc, char *argv[]) -> int {
+  std::size_t ticks = 1'000'000;
+  for (int i = 1; i + 1 < argc; i += 2) {
+    if (std::string_view{argv[i]} == "--ticks") {
+      ticks = std::strtoul(argv[i + 1], nullptr, 10);
+    }
+  }
+
+  constexpr float kDeltaTime = 1.0f / static_cast<float>(kFramesPerSecond);
+  constexpr std::size_t kWarmUpTicks = 100 * kFramesPerSecond; // past the final wave switch
+
+  Grid grid{kDefaultMaze};
+  GameContext context;
+  GhostWaveManager waves;
+  Pacman pacman;
+
+  using Ghosts = std::array<Ghost, kGhostCount>;
+  Ghosts start{Ghost{BlinkyPersonality{}}, Ghost{InkyPersonality{}}, Ghost{PinkyPersonality{}},
+               Ghost{ClydePersonality{}}};
+  for (auto &ghost : start) {
+    ghost.Activate();
+  }
+  for (std::size_t i = 0; i < kWarmUpTicks; ++i) {
+    waves.Update(kDeltaTime);
+    for (auto &ghost : start) {
+      ghost.Update(kDeltaTime, grid, context, pacman, start[0], waves);
+    }
+  }
+
+  // Filled at run time, as Ghost's constructor used to, so the calls stay indirect
+  std::array<Targeter, kGhostCount> targeters{};
+  for (std::size_t i = 0; i < kGhostCount; ++i) {
+    targeters[i] = kTargeters[start[i].GetPersonality()];
+  }
+
+  const auto strides = StridesFor(context.level, context.tick, kDeltaTime);
+  auto time = [&](Ghosts &ghosts, auto &&step) {
+    auto begin = std::chrono::steady_clock::now();
+    for (std::size_t tick = 0; tick < ticks; ++tick) {
+      for (std::size_t i = 0; i < kGhostCount; ++i) {
+        step(ghosts[i], i, ghosts[0]);
+      }
+    }
+    auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - begin).count();
+    return elapsed / static_cast<double>(ticks * kGhostCount);
+  };
+
+  auto indirect = start;
+  auto indirectNs = time(indirect, [&](Ghost &ghost, std::size_t i, Ghost &blinky) {
+    ghost.UpdateMovement(strides, grid, targeters[i](ghost, pacman, blinky, GhostMode::kChase));
+  });
+
+  auto policy = start;
+  auto policyNs = time(policy, [&](Ghost &ghost, std::size_t /*i*/, Ghost &blinky) {
+    GhostPersonalities::Visit(ghost.GetPersonality(), [&]<GhostPersonality Personality>() {
+      ghost.UpdateMovement(strides, grid, Personality::ChaseTarget(ghost, pacman, blinky));
+    });
+  });
+
+  auto full = start;
+  auto fullNs = time(full, [&](Ghost &ghost, std::size_t /*i*/, Ghost &blinky) {
+    ghost.Update(kDeltaTime, grid, context, pacman, blinky, waves);
+  });
+
+  std::size_t mismatches = 0;
+  for (std::size_t i = 0; i < kGhostCount; ++i) {
+    auto expected = indirect[i].Snapshot();
+    mismatches += (policy[i].Snapshot() != expected || full[i].Snapshot() != expected) ? 1 : 0;
+  }
+
+  std::cout << std::fixed << std::setprecision(2) << "ghost steps:        " << ticks * kGhostCount << "\n"
+            << "Targeter pointer:   " << indirectNs << " ns/ghost\n"
+            << "personality policy: " << policyNs << " ns/ghost\n"
+            << "Ghost::Update:      " << fullNs << " ns/ghost\n"
+            << "mismatches:         " << mismatches << "\n";
+
+  return mismatches == 0 ? 0 : 1;
+}
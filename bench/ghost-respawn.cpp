@@ -0,0 +1,121 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+#include "default-maze.h"
+#include "ghost.h"
+
+namespace {
+
+constexpr float kDeltaTime = 1.0f / static_cast<float>(kFramesPerSecond);
+constexpr std::size_t kGiveUpTicks = 60 * kFramesPerSecond;
+constexpr std::array<Direction, 4> kHeadings{Direction::kNorth, Direction::kSouth, Direction::kEast, Direction::kWest};
+
+struct Trips {
+  std::size_t trips{0};
+  std::size_t ticks{0};
+  std::size_t longest{0};
+  std::size_t stranded{0}; ///< Trips that had not arrived after kGiveUpTicks
+  double nanoseconds{0};
+
+  auto Record(std::size_t tripTicks, bool arrived, double elapsed) -> void {
+    trips++;
+    ticks += tripTicks;
+    longest = std::max(longest, tripTicks);
+    stranded += arrived ? 0 : 1;
+    nanoseconds += elapsed;
+  }
+};
+
+auto print(const char *label, const Trips &trips) -> void {
+  std::cout << label << "mean " << static_cast<double>(trips.ticks) / static_cast<double>(trips.trips)
+            << " ticks, longest " << trips.longest << ", stranded " << trips.stranded << ", "
+            << trips.nanoseconds / static_cast<double>(trips.ticks) << " ns/tick\n";
+}
+
+} // namespace
+
+/**
+ * Sends each ghost's eyes home from every corridor cell outside the pen, once
+ * per heading that does not face a wall. Each trip runs with the former rule
+ * (greedy steering toward the ghost's start cell, at respawn speed) and along
+ * Grid::HeadingHome, through the gate and down into the pen, and reports trip
+ * lengths in ticks and the cost of a movement tick. Exits with status 1 if a
+ * flow-field trip fails to reach the start cell or takes a different number of
+ * ticks through RespawningState.
+ *
+ * Usage: ghost_respawn
+ */
+auto main() -> int {
+  Grid grid{kDefaultMaze};
+  GameContext context;
+  GhostWaveManager waves;
+  Pacman pacman;
+  // Ghost::Update reads the same strides, since nothing advances context.tick here
+  const auto strides = StridesFor(context.level, context.tick, kDeltaTime);
+  const std::array<Ghost, kGhostCount> ghosts{Ghost{BlinkyPersonality{}}, Ghost{InkyPersonality{}},
+                                              Ghost{PinkyPersonality{}}, Ghost{ClydePersonality{}}};
+
+  Trips greedy;
+  Trips field;
+  std::size_t mismatches = 0;
+  for (std::size_t g = 0; g < kGhostCount; ++g) {
+    const auto &home = kGhostStartCells[g];
+    for (int y = 0; y < kGridHeight; ++y) {
+      for (int x = 0; x < kGridWidth; ++x) {
+        if (grid.HeadingHome(x, y, g) == Direction::kNeutral) {
+          continue;
+        }
+
+        for (auto heading : kHeadings) {
+          auto start = ghosts[g];
+          start.SetPosition({.x = x * kCellSize + kCellSize / 2.0f, .y = y * kCellSize + kCellSize / 2.0f});
+          if (start.IsInPen() || grid.IsWall(start.NextCell(heading))) {
+            continue;
+          }
+          start.SetHeading(heading);
+          start.SetVelocityForHeading(heading);
+
+          auto ghost = start;
+          std::size_t ticks = 0;
+          auto begin = std::chrono::steady_clock::now();
+          do {
+            ghost.UpdateMovement(strides, grid, home, Direction::kNeutral, Speed::kGhostRespawning);
+            ticks++;
+          } while (ghost.GetCell() != home && ticks < kGiveUpTicks);
+          greedy.Record(ticks, ticks < kGiveUpTicks,
+                        std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - begin).count());
+
+          ghost = start;
+          ticks = 0;
+          begin = std::chrono::steady_clock::now();
+          do {
+            ghost.FollowHomeField(strides, grid, Speed::kGhostRespawning);
+            ticks++;
+          } while (ghost.GetCell() != home && ticks < kGiveUpTicks);
+          field.Record(ticks, ticks < kGiveUpTicks,
+                       std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - begin).count());
+
+          // The same trip through RespawningState must take as long
+          ghost = start;
+          ghost.TransitionTo(GhostStateType::kRespawning);
+          std::size_t stateTicks = 0;
+          while (ghost.IsRespawning() && stateTicks < kGiveUpTicks) {
+            ghost.Update(kDeltaTime, grid, context, pacman, ghost, waves);
+            stateTicks++;
+          }
+          mismatches += stateTicks == ticks ? 0 : 1;
+        }
+      }
+    }
+  }
+
+  std::cout << std::fixed << std::setprecision(2) << "trips:       " << field.trips << "\n";
+  print("greedy:      ", greedy);
+  print("flow field:  ", field);
+  std::cout << "mismatches:  " << mismatches << "\n";
+
+  return field.stranded == 0 && mismatches == 0 ? 0 : 1;
+}
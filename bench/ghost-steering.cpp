@@ -0,0 +1,116 @@
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string_view>
+#include <vector>
+
+#include "ghost-steering.h"
+
+namespace {
+
+/// The per-ghost choice SteerTowards replaced: collect the open moves, then keep
+/// the first one with the smallest Vec2::Distance (pow and sqrt) to the target.
+auto steerByDistance(const Vec2 &cell, const Vec2 &target, MoveMask open) -> Direction {
+  struct Candidate {
+    Vec2 position;
+    Direction heading;
+  };
+
+  std::vector<Candidate> candidates;
+  for (std::size_t i = 0; i < kMoveHeadings.size(); ++i) {
+    if ((open & (1u << i)) != 0) {
+      candidates.push_back({cell + Vec2{kSteeringOffsetX[i], kSteeringOffsetY[i]}, kMoveHeadings[i]});
+    }
+  }
+  if (candidates.empty()) {
+    return Direction::kNeutral;
+  }
+
+  auto closest = candidates[0];
+  for (const auto &candidate : candidates) {
+    if (candidate.position.Distance(target) < closest.position.Distance(target)) {
+      closest = candidate;
+    }
+  }
+  return closest.heading;
+}
+
+} // namespace
+
+/**
+ * Times heading selection for a crowd of ghosts at intersections: the former
+ * per-ghost Vec2::Distance loop, SteerTowards one ghost at a time, and the SoA
+ * batch kernel. Exits with status 1 if they disagree on any heading.
+ *
+ * Usage: ghost_steering [--ghosts N] [--rounds N]
+ */
+auto main(int argc, char *argv[]) -> int {
+  std::size_t ghosts = 512;
+  std::size_t rounds = 20'000;
+  for (int i = 1; i + 1 < argc; i += 2) {
+    std::string_view arg{argv[i]};
+    if (arg == "--ghosts") {
+      ghosts = std::strtoul(argv[i + 1], nullptr, 10);
+    } else if (arg == "--rounds") {
+      rounds = std::strtoul(argv[i + 1], nullptr, 10);
+    }
+  }
+
+  // Cells and targets are whole cells, as in the game; masks include dead ends
+  std::mt19937 rng{1};
+  std::uniform_int_distribution<int> column{0, 27};
+  std::uniform_int_distribution<int> row{0, 35};
+  std::uniform_int_distribution<int> mask{0, 15};
+
+  SteeringBatch batch;
+  batch.Resize(ghosts);
+  for (std::size_t ghost = 0; ghost < ghosts; ++ghost) {
+    batch.cellX[ghost] = static_cast<float>(column(rng));
+    batch.cellY[ghost] = static_cast<float>(row(rng));
+    batch.targetX[ghost] = static_cast<float>(column(rng));
+    batch.targetY[ghost] = static_cast<float>(row(rng));
+    batch.open[ghost] = static_cast<MoveMask>(mask(rng));
+  }
+
+  std::vector<Direction> expected(ghosts);
+  std::vector<Direction> single(ghosts);
+  std::vector<Direction> batched(ghosts);
+
+  auto time = [&](auto &&steer) {
+    auto begin = std::chrono::steady_clock::now();
+    for (std::size_t round = 0; round < rounds; ++round) {
+      steer();
+    }
+    auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - begin).count();
+    return elapsed / static_cast<double>(rounds * ghosts);
+  };
+
+  auto distanceNs = time([&] {
+    for (std::size_t ghost = 0; ghost < ghosts; ++ghost) {
+      expected[ghost] = steerByDistance({batch.cellX[ghost], batch.cellY[ghost]},
+                                        {batch.targetX[ghost], batch.targetY[ghost]}, batch.open[ghost]);
+    }
+  });
+  auto singleNs = time([&] {
+    for (std::size_t ghost = 0; ghost < ghosts; ++ghost) {
+      single[ghost] = SteerTowards({batch.cellX[ghost], batch.cellY[ghost]},
+                                   {batch.targetX[ghost], batch.targetY[ghost]}, batch.open[ghost]);
+    }
+  });
+  auto batchNs = time([&] { SteerTowards(batch, batched); });
+
+  std::size_t mismatches = 0;
+  for (std::size_t ghost = 0; ghost < ghosts; ++ghost) {
+    mismatches += (single[ghost] != expected[ghost] || batched[ghost] != expected[ghost]) ? 1 : 0;
+  }
+
+  std::cout << std::fixed << std::setprecision(2) << "ghosts:            " << ghosts << "\n"
+            << "Vec2::Distance:    " << distanceNs << " ns/ghost\n"
+            << "SteerTowards:      " << singleNs << " ns/ghost\n"
+            << "SoA batch kernel:  " << batchNs << " ns/ghost\n"
+            << "mismatches:        " << mismatches << "\n";
+
+  return mismatches == 0 ? 0 : 1;
+}
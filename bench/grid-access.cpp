@@ -0,0 +1,138 @@
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string_view>
+#include <vector>
+
+#include "default-maze.h"
+#include "grid.h"
+
+namespace {
+
+/// The nested-vector grid this benchmark measures against: floor() and two
+/// bounds-checked lookups per access, and pellets counted by scanning.
+class NestedGrid {
+public:
+  explicit NestedGrid(std::vector<std::vector<Cell>> cells) : cells_{std::move(cells)} {}
+
+  auto GetCell(const Vec2 &position) const -> Cell {
+    if (position.x < 0 || position.y < 0) {
+      return Cell::kOffGrid;
+    }
+    if (std::floor(position.x) >= kGridWidth) {
+      return Cell::kOffGrid;
+    }
+    return cells_.at(std::floor(position.y)).at(std::floor(position.x));
+  }
+
+  auto HasPellet(const Vec2 &position) const -> bool {
+    return GetCell(position) == Cell::kPellet || GetCell(position) == Cell::kPowerPellet;
+  }
+
+  auto PelletsLeft() const -> std::size_t {
+    std::size_t count = 0;
+    for (const auto &row : cells_) {
+      for (auto cell : row) {
+        count += (cell == Cell::kPellet || cell == Cell::kPowerPellet) ? 1 : 0;
+      }
+    }
+    return count;
+  }
+
+private:
+  std::vector<std::vector<Cell>> cells_;
+};
+
+template <typename Fn> auto nanosPerCall(std::size_t calls, Fn &&fn) -> double {
+  auto start = std::chrono::steady_clock::now();
+  std::size_t sink = 0;
+  for (std::size_t i = 0; i < calls; ++i) {
+    sink += fn(i);
+  }
+  auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+  // Keep the results observable so the loops are not optimised away
+  volatile auto observed = sink;
+  (void)observed;
+
+  return elapsed / static_cast<double>(calls);
+}
+
+auto report(std::string_view name, double nested, double flat) -> void {
+  std::cout << std::left << std::setw(16) << name << std::right << std::fixed << std::setprecision(2) << std::setw(12)
+            << nested << std::setw(12) << flat << std::setw(9) << nested / flat << "x\n";
+}
+
+} // namespace
+
+/**
+ * Compares Grid lookups, legal-move masks and pellet counting against the
+ * nested-vector layout it replaced.
+ *
+ * Usage: grid_access [--calls N]
+ */
+auto main(int argc, char *argv[]) -> int {
+  std::size_t calls = 50'000'000;
+  for (int i = 1; i + 1 < argc; i += 2) {
+    if (std::string_view{argv[i]} == "--calls") {
+      calls = std::strtoul(argv[i + 1], nullptr, 10);
+    }
+  }
+
+  std::vector<std::vector<Cell>> cells(kGridHeight);
+  for (int y = 0; y < kGridHeight; ++y) {
+    auto row = kDefaultMaze.begin() + Grid::Index(0, y);
+    cells[y].assign(row, row + kGridWidth);
+  }
+  NestedGrid nested{cells};
+  Grid flat{kDefaultMaze};
+
+  // Random cells, some just off the board as ghosts in the tunnel produce
+  std::mt19937 rng{1};
+  std::uniform_int_distribution<int> column{-2, kGridWidth + 1};
+  std::uniform_int_distribution<int> row{0, kGridHeight - 1};
+  std::vector<Vec2> positions(4096);
+  for (auto &position : positions) {
+    position = Vec2{static_cast<float>(column(rng)), static_cast<float>(row(rng))};
+  }
+  const auto mask = positions.size() - 1;
+
+  // Cells whose north and south neighbours are on the board, for the neighbour tests
+  std::uniform_int_distribution<int> innerRow{1, kGridHeight - 2};
+  std::vector<Vec2> inner(positions.size());
+  for (auto &position : inner) {
+    position = Vec2{static_cast<float>(column(rng)), static_cast<float>(innerRow(rng))};
+  }
+
+  std::cout << "calls: " << calls << "\n\n";
+  std::cout << std::left << std::setw(16) << "ns/call" << std::right << std::setw(12) << "nested" << std::setw(12)
+            << "flat" << std::setw(10) << "speedup" << "\n";
+
+  report("wall test",
+         nanosPerCall(calls, [&](std::size_t i) { return nested.GetCell(positions[i & mask]) == Cell::kWall; }),
+         nanosPerCall(calls, [&](std::size_t i) { return flat.IsWall(positions[i & mask]); }));
+
+  // Four neighbour wall tests, as ghosts and Pacman made them, against one exit-table read
+  report("open moves", nanosPerCall(calls, [&](std::size_t i) {
+           MoveMask open = 0;
+           for (std::size_t move = 0; move < kMoveHeadings.size(); ++move) {
+             auto next = inner[i & mask] + Vec2{static_cast<float>(kMoveOffsetX[move]),
+                                                    static_cast<float>(kMoveOffsetY[move])};
+             open |= nested.GetCell(next) == Cell::kWall ? 0 : static_cast<MoveMask>(1u << move);
+           }
+           return open;
+         }),
+         nanosPerCall(calls, [&](std::size_t i) { return flat.GhostExits(inner[i & mask]); }));
+
+  report("pellet test", nanosPerCall(calls, [&](std::size_t i) { return nested.HasPellet(positions[i & mask]); }),
+         nanosPerCall(calls, [&](std::size_t i) { return flat.HasPellet(positions[i & mask]); }));
+
+  const auto countCalls = calls / 100;
+  report("pellets left", nanosPerCall(countCalls, [&](std::size_t) { return nested.PelletsLeft(); }),
+         nanosPerCall(countCalls, [&](std::size_t) { return flat.PelletsLeft(); }));
+
+  return 0;
+}
@@ -0,0 +1,153 @@
+#include <array>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string_view>
+
+#include "constants.h"
+#include "simulation.h"
+
+namespace {
+
+constexpr float kGameSeconds = 120.0f;
+constexpr std::array<int, 5> kFramesPerStep{2, 4, 6, 12, 30};
+
+/// How one game ended, played until Pacman's first death or kGameSeconds.
+struct Outcome {
+  float seconds{0};
+  int score{0};
+  int wallTicks{0}; ///< Steps that ended with an actor inside a wall
+};
+
+enum class Mode {
+  kFine,       ///< Each coarse step played as 1/60 s Steps: the reference
+  kSubstepped, ///< One Step per coarse step
+};
+
+auto inWall(const Simulation &simulation) -> bool {
+  const auto &grid = simulation.GetGrid();
+  if (grid.IsWall(simulation.GetPacman().GetCell())) {
+    return true;
+  }
+  for (const auto &ghost : simulation.GetGhosts()) {
+    if (grid.IsWall(ghost.GetCell())) {
+      return true;
+    }
+  }
+  return false;
+}
+
+auto play(Mode mode, int framesPerStep, unsigned int seed) -> Outcome {
+  NullSoundSink sound;
+  Simulation simulation{sound};
+  simulation.NewGame();
+
+  // Inputs change only between coarse steps, so every mode sees the same ones
+  std::mt19937 rng{seed};
+  std::uniform_int_distribution<int> turn{0, 3};
+  std::uniform_int_distribution<int> direction{1, 4};
+  auto heading = Direction::kWest;
+
+  const float stepTime = kTickSeconds * static_cast<float>(framesPerStep);
+  Outcome outcome;
+  while (outcome.seconds < kGameSeconds) {
+    if (turn(rng) == 0) {
+      heading = static_cast<Direction>(direction(rng));
+    }
+    simulation.ProcessInput(heading);
+
+    auto status = SimulationStatus::kRunning;
+    switch (mode) {
+    case Mode::kFine:
+      for (int frame = 0; frame < framesPerStep && status == SimulationStatus::kRunning; ++frame) {
+        status = simulation.Step(kTickSeconds);
+        outcome.wallTicks += inWall(simulation) ? 1 : 0;
+      }
+      break;
+    case Mode::kSubstepped:
+      status = simulation.Step(stepTime);
+      outcome.wallTicks += inWall(simulation) ? 1 : 0;
+      break;
+    }
+    outcome.seconds += stepTime;
+
+    if (status == SimulationStatus::kPacmanKilled) {
+      break;
+    }
+    if (status == SimulationStatus::kLevelComplete) {
+      simulation.Resolve(status);
+    }
+  }
+
+  outcome.score = simulation.GetContext().score;
+  return outcome;
+}
+
+struct Summary {
+  double seconds{0};
+  double score{0};
+  double scoreError{0}; ///< Mean |score - reference score|
+  long long wallTicks{0};
+
+  auto Add(const Outcome &outcome, const Outcome &reference) -> void {
+    seconds += outcome.seconds;
+    score += outcome.score;
+    scoreError += std::abs(outcome.score - reference.score);
+    wallTicks += outcome.wallTicks;
+  }
+};
+
+auto print(const char *label, const Summary &summary, int games) -> void {
+  std::cout << "  " << label << std::setw(10) << summary.seconds / games << std::setw(10) << summary.score / games
+            << std::setw(12) << summary.scoreError / games << std::setw(12) << summary.wallTicks << "\n";
+}
+
+} // namespace
+
+/**
+ * Plays the same games at coarse time steps two ways: as 1/60 s Steps (the
+ * reference) and as one sub-stepped Step per coarse step. Reports mean survival
+ * time, mean score, mean score difference from the reference, and steps that
+ * ended with an actor inside a wall. Step splits at reference ticks, so both
+ * ways must play identical games: exits with status 1 if any game's survival
+ * time or score differs from the reference.
+ *
+ * Usage: large_step [--games N]
+ */
+auto main(int argc, char *argv[]) -> int {
+  int games = 200;
+  for (int i = 1; i + 1 < argc; i += 2) {
+    if (std::string_view{argv[i]} == "--games") {
+      games = std::atoi(argv[i + 1]);
+    }
+  }
+
+  std::cout << std::fixed << std::setprecision(1) << "games: " << games << ", up to " << kGameSeconds
+            << " s each\n\n";
+  std::cout << "  " << std::setw(12) << "" << std::setw(10) << "seconds" << std::setw(10) << "score" << std::setw(12)
+            << "score diff" << std::setw(12) << "wall steps" << "\n";
+
+  int mismatches = 0;
+  for (auto framesPerStep : kFramesPerStep) {
+    Summary fine;
+    Summary substepped;
+    for (int game = 0; game < games; ++game) {
+      auto seed = static_cast<unsigned int>(game + 1);
+      auto reference = play(Mode::kFine, framesPerStep, seed);
+      auto outcome = play(Mode::kSubstepped, framesPerStep, seed);
+      fine.Add(reference, reference);
+      substepped.Add(outcome, reference);
+      mismatches += outcome.seconds != reference.seconds || outcome.score != reference.score ? 1 : 0;
+    }
+
+    std::cout << kFramesPerSecond / framesPerStep << " Hz (" << Simulation::Substeps(kTickSeconds * framesPerStep)
+              << " sub-steps)\n";
+    print("1/60 s     ", fine, games);
+    print("sub-stepped", substepped, games);
+  }
+
+  std::cout << "\nmismatched games: " << mismatches << "\n";
+  return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,81 @@
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string_view>
+#include <vector>
+
+#include "default-maze.h"
+#include "grid.h"
+#include "maze-graph.h"
+
+/**
+ * Reports MazeGraph build time, memory footprint and distance lookup latency,
+ * next to the Euclidean Vec2::Distance it can stand in for.
+ *
+ * Usage: maze_distance [--lookups N]
+ */
+auto main(int argc, char *argv[]) -> int {
+  std::size_t lookups = 50'000'000;
+  for (int i = 1; i + 1 < argc; i += 2) {
+    if (std::string_view{argv[i]} == "--lookups") {
+      lookups = std::strtoul(argv[i + 1], nullptr, 10);
+    }
+  }
+
+  Grid grid{kDefaultMaze};
+
+  auto start = std::chrono::steady_clock::now();
+  MazeGraph graph{grid};
+  auto buildMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+  // Random pairs of walkable cells
+  const auto cells = graph.Cells();
+  std::mt19937 rng{1};
+  std::uniform_int_distribution<std::size_t> pick{0, cells.size() - 1};
+  std::vector<std::pair<Vec2, Vec2>> pairs(4096);
+  for (auto &[from, to] : pairs) {
+    auto a = cells[pick(rng)];
+    auto b = cells[pick(rng)];
+    from = Vec2{static_cast<float>(a.x), static_cast<float>(a.y)};
+    to = Vec2{static_cast<float>(b.x), static_cast<float>(b.y)};
+  }
+  const auto mask = pairs.size() - 1;
+
+  auto time = [&](auto &&distance) {
+    auto begin = std::chrono::steady_clock::now();
+    double sink = 0.0;
+    for (std::size_t i = 0; i < lookups; ++i) {
+      const auto &[from, to] = pairs[i & mask];
+      sink += distance(from, to);
+    }
+    auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - begin).count();
+
+    // Keep the results observable so the loop is not optimised away
+    volatile double observed = sink;
+    (void)observed;
+
+    return elapsed / static_cast<double>(lookups);
+  };
+
+  auto mazeNs = time([&](const Vec2 &from, const Vec2 &to) { return graph.Distance(from, to); });
+  auto euclideanNs = time([](const Vec2 &from, const Vec2 &to) { return from.Distance(to); });
+
+  int longest = 0;
+  for (const auto &a : cells) {
+    for (const auto &b : cells) {
+      longest = std::max(longest, graph.Distance(a.x, a.y, b.x, b.y));
+    }
+  }
+
+  std::cout << std::fixed << std::setprecision(2) << "walkable cells:    " << cells.size() << "\n"
+            << "junctions:         " << graph.Junctions().size() << "\n"
+            << "longest path:      " << longest << " steps\n"
+            << "build (ms):        " << buildMs << "\n"
+            << "memory (KiB):      " << static_cast<double>(graph.MemoryFootprint()) / 1024.0 << "\n"
+            << "maze distance:     " << mazeNs << " ns/lookup\n"
+            << "euclidean:         " << euclideanNs << " ns/lookup\n";
+
+  return 0;
+}
@@ -0,0 +1,137 @@
+#include <bit>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string_view>
+
+#include "replay.h"
+#include "simulation.h"
+
+namespace {
+
+static_assert(kFixedPointMovement, "the expected hash holds for fixed-point builds only");
+
+/// Hash of kExpectedTicks recorded ticks from seed kSeed. Fixed-point games must
+/// play out bit-identically on every compiler, optimisation level and platform,
+/// so a change here means movement or game rules changed: update it together
+/// with kReplayVersion.
+constexpr std::uint64_t kExpectedHash = 0x776864b6210199cf;
+constexpr std::uint64_t kExpectedTicks = 60 * 60 * 10;
+constexpr unsigned int kSeed = 1;
+
+/// FNV-1a over the parts of the world a replay must reproduce. Fields are folded
+/// one by one rather than hashing snapshot bytes, which include padding.
+class StateHash {
+public:
+  auto Add(std::uint32_t value) -> void {
+    for (int byte = 0; byte < 4; ++byte) {
+      hash_ = (hash_ ^ ((value >> (byte * 8)) & 0xffu)) * 0x100000001b3ull;
+    }
+  }
+
+  auto Add(int value) -> void { Add(static_cast<std::uint32_t>(value)); }
+  auto Add(float value) -> void { Add(std::bit_cast<std::uint32_t>(value)); }
+  auto Add(const Vec2 &value) -> void {
+    Add(value.x);
+    Add(value.y);
+  }
+
+  auto Add(const Simulation &simulation) -> void {
+    const auto &context = simulation.GetContext();
+    Add(context.score);
+    Add(context.extraLives);
+    Add(context.level);
+    Add(context.pelletsConsumed);
+    Add(context.tick);
+    Add(simulation.GetPacman().GetPosition());
+    Add(simulation.GetPacman().GetEnergizedFor());
+    for (const auto &ghost : simulation.GetGhosts()) {
+      Add(ghost.GetPosition());
+      Add(static_cast<int>(ghost.Snapshot().stateType));
+    }
+  }
+
+  auto Value() const -> std::uint64_t { return hash_; }
+
+private:
+  std::uint64_t hash_{0xcbf29ce484222325ull};
+};
+
+/// Applies one tick of `input`, starting a new game when the last life is lost.
+auto tick(Simulation &simulation, TickInput input) -> void {
+  simulation.ProcessInput(input.heading);
+  auto status = simulation.Step(kTickSeconds);
+  if (status != SimulationStatus::kRunning && simulation.Resolve(status)) {
+    simulation.NewGame();
+  }
+}
+
+} // namespace
+
+/**
+ * Records kExpectedTicks ticks of random input in a fixed-point build, hashing
+ * the world after every tick, then plays the replay file back and hashes again.
+ * Exits with status 1 if playback diverges from the recording, or if the hash
+ * differs from kExpectedHash: the same input must give the same game on every
+ * build.
+ *
+ * Usage: replay_hash [--replay PATH]
+ */
+auto main(int argc, char *argv[]) -> int {
+  auto path = (std::filesystem::temp_directory_path() / "pacman-replay-hash.rpl").string();
+  for (int i = 1; i + 1 < argc; i += 2) {
+    if (std::string_view{argv[i]} == "--replay") {
+      path = argv[i + 1];
+    }
+  }
+
+  // Raw engine output, as distributions may differ between standard libraries
+  std::mt19937 rng{kSeed};
+  auto heading = Direction::kWest;
+
+  NullSoundSink sound;
+  StateHash recorded;
+  {
+    Simulation simulation{sound};
+    simulation.NewGame();
+    ReplayRecorder recorder{kFramesPerSecond, kSeed, kFramesPerSecond * 10};
+    for (std::uint64_t t = 0; t < kExpectedTicks; ++t) {
+      if (rng() % 8 == 0) {
+        heading = static_cast<Direction>(1 + rng() % 4);
+      }
+      TickInput input{.heading = heading};
+      recorder.Append(input, simulation);
+      tick(simulation, input);
+      recorded.Add(simulation);
+    }
+    recorder.Save(path);
+  }
+
+  StateHash played;
+  std::size_t keyframeMismatches = 0;
+  {
+    ReplayReader replay{path};
+    Simulation simulation{sound};
+    simulation.NewGame();
+    for (std::uint64_t t = 0; t < replay.TickCount(); ++t) {
+      const auto *keyframe = replay.KeyframeAt(t);
+      if (keyframe != nullptr && !(keyframe->snapshot == simulation.Snapshot())) {
+        keyframeMismatches += 1;
+      }
+      tick(simulation, replay.InputAt(t));
+      played.Add(simulation);
+    }
+  }
+  std::filesystem::remove(path);
+
+  std::cout << std::hex << std::setfill('0') << "recorded hash: 0x" << std::setw(16) << recorded.Value() << "\n"
+            << "replayed hash: 0x" << std::setw(16) << played.Value() << "\n"
+            << "expected hash: 0x" << std::setw(16) << kExpectedHash << "\n"
+            << std::dec << "keyframe mismatches: " << keyframeMismatches << "\n";
+
+  const bool ok = recorded.Value() == kExpectedHash && played.Value() == kExpectedHash && keyframeMismatches == 0;
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,112 @@
+#ifndef ANIMATION_H
+#define ANIMATION_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+
+#include "constants.h"
+
+/// What a clip shows once it has played its last frame.
+enum class LoopMode {
+  kLoop, ///< Starts again from the first frame
+  kHold, ///< Stays on the last frame
+};
+
+inline constexpr std::size_t kMaxClipFrames = 4;
+
+/// Frames of one sprite sheet played at a fixed rate. Clips are constant data
+/// in kClips; a Sprite refers to one by its Clip ID.
+struct AnimationClip {
+  constexpr AnimationClip(std::initializer_list<int> frames, int fps, LoopMode loop = LoopMode::kLoop)
+      : frameCount{frames.size()}, fps{fps}, loop{loop} {
+    std::copy(frames.begin(), frames.end(), this->frames.begin());
+  }
+
+  /// Returns the sheet frame shown `seconds` after the clip started.
+  constexpr auto FrameAt(double seconds) const -> int {
+    if (frameCount < 2 || fps == 0 || seconds <= 0) {
+      return frames[0];
+    }
+
+    auto tick = static_cast<std::size_t>(seconds * fps);
+    if (loop == LoopMode::kHold) {
+      return frames[std::min(tick, frameCount - 1)];
+    }
+    return frames[tick % frameCount];
+  }
+
+  std::array<int, kMaxClipFrames> frames{};
+  std::size_t frameCount;
+  int fps;
+  LoopMode loop;
+};
+
+/// IDs of the clips in kClips. Clips that vary with heading are laid out in
+/// Direction order (kNeutral, kNorth, kSouth, kEast, kWest); see ForHeading.
+enum class Clip {
+  kStill, ///< The first frame of the sheet
+  kPacmanNeutral,
+  kPacmanNorth,
+  kPacmanSouth,
+  kPacmanEast,
+  kPacmanWest,
+  kGhostNeutral,
+  kGhostNorth,
+  kGhostSouth,
+  kGhostEast,
+  kGhostWest,
+  kEyesNeutral,
+  kEyesNorth,
+  kEyesSouth,
+  kEyesEast,
+  kEyesWest,
+  kPowerPelletBlink,
+};
+
+/// Number of Clip values. kPowerPelletBlink must stay last.
+inline constexpr std::size_t kClipCount = static_cast<std::size_t>(Clip::kPowerPelletBlink) + 1;
+
+/// Every animation clip, indexed by Clip.
+inline constexpr std::array<AnimationClip, kClipCount> kClips{{
+    {{0}, 0},
+    {{1, 2}, 8},
+    {{5, 6}, 8},
+    {{7, 8}, 8},
+    {{1, 2}, 8},
+    {{3, 4}, 8},
+    {{2, 3}, kGhostFps},
+    {{4, 5}, kGhostFps},
+    {{6, 7}, kGhostFps},
+    {{0, 1}, kGhostFps},
+    {{2, 3}, kGhostFps},
+    {{1}, 0},
+    {{2}, 0},
+    {{3}, 0},
+    {{0}, 0},
+    {{1}, 0},
+    {{1, 2}, 3},
+}};
+
+constexpr auto GetClip(Clip clip) -> const AnimationClip & { return kClips[static_cast<std::size_t>(clip)]; }
+
+/// Returns the clip for `heading` from the set whose kNeutral clip is `neutral`.
+constexpr auto ForHeading(Clip neutral, Direction heading) -> Clip {
+  return static_cast<Clip>(static_cast<int>(neutral) + static_cast<int>(heading));
+}
+
+/// Time shared by a group of animated sprites. It is advanced once per tick, and
+/// each sprite works out its frame from it when drawn, so an animation that
+/// keeps playing costs no per-sprite update.
+class AnimationClock {
+public:
+  void Advance(float deltaTime) { seconds_ += deltaTime; }
+
+  auto Seconds() const -> double { return seconds_; }
+
+private:
+  double seconds_{0};
+};
+
+#endif
@@ -18,7 +18,7 @@ AssetManager::~AssetManager() {
 
 static AssetRegistry Registry;
 
-auto AssetManager::LoadTexture(SDL_Renderer *renderer, Sprites sprite) -> SDL_Texture * {
+auto AssetManager::LoadSurface(Sprites sprite) -> SDL_Surface * {
   const auto assetPath = Registry.GetSpritePath(sprite);
   if (!assetPath.has_value()) {
     throw std::runtime_error("Unknown sprite enum");
@@ -30,11 +30,7 @@ auto AssetManager::LoadTexture(SDL_Renderer *renderer, Sprites sprite) -> SDL_Te
     std::abort();
   }
 
-  SDL_Texture *texture = SDL_CreateTextureFromSurface(renderer, surface);
-  SDL_assert(texture != nullptr);
-  SDL_FreeSurface(surface);
-
-  return texture;
+  return surface;
 }
 
 auto AssetManager::getSound(const std::string &asset) -> Mix_Chunk * {
@@ -22,7 +22,8 @@ public:
   /// Loads a sound effect by Sound enum. Returns cached sound or loads and caches it.
   auto GetSound(Sounds sound) -> Mix_Chunk *;
 
-  static auto LoadTexture(SDL_Renderer *renderer, Sprites sprite) -> SDL_Texture *;
+  /// Decodes a sprite sheet into a surface the caller frees. Aborts if the file cannot be read.
+  static auto LoadSurface(Sprites sprite) -> SDL_Surface *;
 
 private:
   /// Loads a sound effect by asset path. Returns cached sound or loads and caches it.
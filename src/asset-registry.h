@@ -32,6 +32,9 @@ enum class Sprites {
   kWhiteText    ///< White text font
 };
 
+/// Number of Sprites values. kWhiteText must stay last.
+inline constexpr std::size_t kSpriteCount = static_cast<std::size_t>(Sprites::kWhiteText) + 1;
+
 /// Central registry mapping asset enums to file paths.
 class AssetRegistry {
 public:
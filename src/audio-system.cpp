@@ -104,6 +104,10 @@ auto AudioSystem::PlaySound(Sounds sound, std::optional<int> loop) -> std::pair<
   return {handle, std::move(future)};
 }
 
+auto AudioSystem::Play(Sounds sound, std::optional<int> loop) -> void {
+  [[maybe_unused]] auto [handle, future] = PlaySound(sound, loop);
+}
+
 auto AudioSystem::processAudioQueue() -> void {
   while (true) {
     AudioRequest request;
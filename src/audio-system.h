@@ -10,6 +10,7 @@
 #include <unordered_map>
 
 #include "asset-manager.h"
+#include "sound-sink.h"
 
 /// Unique identifier for tracking individual sounds
 using SoundHandle = uint64_t;
@@ -21,7 +22,7 @@ using SoundHandle = uint64_t;
  * and a queue-based system for processing sound requests. It ensures thread-safe operation
  * and proper resource management.
  */
-class AudioSystem {
+class AudioSystem : public SoundSink {
 public:
   /**
    * @brief Initializes the audio system.
@@ -54,6 +55,14 @@ public:
    */
   auto PlaySound(Sounds sound, std::optional<int> loop) -> std::pair<SoundHandle, std::future<void>>;
 
+  /**
+   * @brief Queues a sound cue raised by the simulation, discarding its handle.
+   *
+   * @param sound The sound effect to play
+   * @param loop Optional number of times to loop the sound (-1 for infinite)
+   */
+  auto Play(Sounds sound, std::optional<int> loop) -> void override;
+
   /**
    * @brief Cancels a specific playing sound by its handle.
    *
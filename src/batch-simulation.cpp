@@ -0,0 +1,54 @@
+#include <stdexcept>
+
+#include "batch-simulation.h"
+#include "default-maze.h"
+
+// Batched games never play audio; the sink is stateless so all games share it.
+static NullSoundSink Silence;
+
+BatchSimulation::BatchSimulation(std::size_t games, std::size_t threads) : pool_{threads} {
+  const Grid grid{kDefaultMaze};
+
+  games_.reserve(games);
+  for (std::size_t i = 0; i < games; ++i) {
+    games_.emplace_back(Silence, grid);
+  }
+
+  results_.statuses.resize(games);
+  results_.gameOver.resize(games);
+  results_.finalScores.resize(games);
+}
+
+auto BatchSimulation::Step(std::span<const Direction> inputs, float deltaTime) -> void {
+  if (inputs.size() != games_.size()) {
+    throw std::invalid_argument("BatchSimulation::Step expects one input per game");
+  }
+
+  inputs_ = inputs;
+  deltaTime_ = deltaTime;
+
+  pool_.ParallelFor(games_.size(), kGrain, [this](std::size_t begin, std::size_t end) { stepRange(begin, end); });
+}
+
+auto BatchSimulation::Reset(std::size_t game) -> void {
+  games_.at(game).NewGame();
+  results_.statuses[game] = SimulationStatus::kRunning;
+  results_.gameOver[game] = 0;
+}
+
+auto BatchSimulation::stepRange(std::size_t begin, std::size_t end) -> void {
+  for (auto game = begin; game < end; ++game) {
+    auto &simulation = games_[game];
+
+    simulation.ProcessInput(inputs_[game]);
+    auto status = simulation.Step(deltaTime_);
+    results_.statuses[game] = status;
+    results_.gameOver[game] = simulation.Resolve(status) ? 1 : 0;
+
+    // Record the final score of a finished game, then start the next one
+    if (results_.gameOver[game] != 0) {
+      results_.finalScores[game] = simulation.GetContext().score;
+      simulation.NewGame();
+    }
+  }
+}
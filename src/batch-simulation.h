@@ -0,0 +1,57 @@
+#ifndef BATCH_SIMULATION_H
+#define BATCH_SIMULATION_H
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "constants.h"
+#include "simulation.h"
+#include "work-stealing-pool.h"
+
+/// Outcome of the last step of every game in a batch, as struct-of-arrays
+/// indexed by game.
+struct BatchResults {
+  std::vector<SimulationStatus> statuses;
+  std::vector<uint8_t> gameOver; ///< 1 if the game ended on the last step and was restarted
+  std::vector<int> finalScores;  ///< Score of the game that ended, valid where gameOver is 1
+};
+
+/// Steps many independent games in one process. The games are held by value in
+/// one contiguous vector, and each game's actors are values inside it, so a worker
+/// stepping a chunk walks adjacent memory rather than chasing per-game heap
+/// objects. Chunks are balanced across a WorkStealingPool. Games that run out of
+/// lives are recorded in `gameOver` and restarted.
+class BatchSimulation {
+public:
+  /// @param games Number of games
+  /// @param threads Worker threads including the caller; 0 uses the hardware concurrency
+  explicit BatchSimulation(std::size_t games, std::size_t threads = 0);
+
+  /// Applies one input per game and advances every game by `deltaTime` seconds.
+  auto Step(std::span<const Direction> inputs, float deltaTime) -> void;
+
+  /// Restarts a single game.
+  auto Reset(std::size_t game) -> void;
+
+  auto Size() const -> std::size_t { return games_.size(); }
+  auto Threads() const -> std::size_t { return pool_.Size(); }
+  auto Games() const -> std::span<const Simulation> { return games_; }
+  auto Results() const -> const BatchResults & { return results_; }
+
+private:
+  auto stepRange(std::size_t begin, std::size_t end) -> void;
+
+  /// Games per chunk handed to the pool; small enough to balance, large enough to amortize queueing.
+  static constexpr std::size_t kGrain = 16;
+
+  std::vector<Simulation> games_;
+
+  BatchResults results_;
+  WorkStealingPool pool_;
+
+  std::span<const Direction> inputs_;
+  float deltaTime_{0.0f};
+};
+
+#endif
@@ -1,33 +1,49 @@
+#include <array>
+#include <charconv>
+#include <limits>
+
 #include "board-manager.h"
 #include "constants.h"
 
-BoardManager::BoardManager(SDL_Renderer *renderer)
-    : maze{renderer, Sprites::kMaze}, pacman{renderer, Sprites::kPacman}, fruits{renderer, Sprites::kFruits},
-      text{renderer, Sprites::kWhiteText} {}
+BoardManager::BoardManager(TextureCache &textures)
+    : maze{textures, Sprites::kMaze}, pacman{textures, Sprites::kPacman}, fruits{textures, Sprites::kFruits},
+      text{textures, Sprites::kWhiteText} {}
 
-void BoardManager::Update(const float deltaTime, GameContext &context) {
-  maze.Update(deltaTime);
+void BoardManager::Update(const GameContext &context) {
+  if (context.score == score && context.extraLives == extraLives && context.level == level) {
+    return;
+  }
 
-  score = std::to_string(context.score);
+  score = context.score;
   extraLives = context.extraLives;
   level = context.level;
+  BuildHud();
 }
 
-void BoardManager::Render(SDL_Renderer *renderer) {
+void BoardManager::Render(SpriteBatch &batch) {
   // Maze
-  maze.Render(renderer, {.x = 0, .y = 0});
+  maze.Render(batch, RenderLayer::kBoard, {.x = 0, .y = 0});
+
+  batch.Draw(RenderLayer::kBoard, hud);
+}
+
+void BoardManager::BuildHud() {
+  hud.Clear();
 
-  RenderExtraLives(renderer);
+  AddExtraLives();
 
-  RenderFruits(renderer);
+  AddFruit();
 
   // Display score
-  WriteText(renderer, kHighScoreCell, "HIGH SCORE");
-  WriteText(renderer, k1UpCell, "1UP");
-  WriteText(renderer, kScoreCell, score);
+  std::array<char, std::numeric_limits<int>::digits10 + 2> digits{};
+  auto written = std::to_chars(digits.data(), digits.data() + digits.size(), score);
+
+  WriteText(kHighScoreCell, "HIGH SCORE");
+  WriteText(k1UpCell, "1UP");
+  WriteText(kScoreCell, {digits.data(), written.ptr});
 }
 
-void BoardManager::RenderExtraLives(SDL_Renderer *renderer) {
+void BoardManager::AddExtraLives() {
   SDL_Rect source;
   source.w = kLifeSize;
   source.h = kLifeSize;
@@ -42,11 +58,11 @@ void BoardManager::RenderExtraLives(SDL_Renderer *renderer) {
     destination.x = static_cast<int>(kLifeCell.x) * kCellSize - (i * kLifeSize);
     destination.y = static_cast<int>(kLifeCell.y) * kCellSize;
 
-    pacman.Render(renderer, source, destination);
+    pacman.Render(hud, source, destination);
   }
 }
 
-void BoardManager::RenderFruits(SDL_Renderer *renderer) {
+void BoardManager::AddFruit() {
   SDL_Rect source;
   source.w = kFruitSize;
   source.h = kFruitSize;
@@ -60,10 +76,10 @@ void BoardManager::RenderFruits(SDL_Renderer *renderer) {
   destination.x = kFruitCell.x * kCellSize;
   destination.y = kFruitCell.y * kCellSize;
 
-  fruits.Render(renderer, source, destination);
+  fruits.Render(hud, source, destination);
 }
 
-void BoardManager::WriteText(SDL_Renderer *renderer, Vec2 position, const std::string &text) {
+void BoardManager::WriteText(Vec2 position, std::string_view text) {
   SDL_Rect source{0, 0, kCellSize, kCellSize};
   SDL_Rect destination{0, 0, kCellSize, kCellSize};
 
@@ -84,6 +100,6 @@ void BoardManager::WriteText(SDL_Renderer *renderer, Vec2 position, const std::s
     destination.x = static_cast<int>(position.x) * kCellSize + static_cast<int>(i) * kCellSize;
     destination.y = static_cast<int>(position.y) * kCellSize;
 
-    this->text.Render(renderer, source, destination);
+    this->text.Render(hud, source, destination);
   }
 }
@@ -1,34 +1,43 @@
 #ifndef BOARD_MANAGER_H
 #define BOARD_MANAGER_H
 
-#include <string>
+#include <string_view>
 
 #include "SDL.h"
 
 #include "game-context.h"
+#include "texture-cache.h"
+#include "sprite-batch.h"
 #include "sprite.h"
 #include "vector2.h"
 
 class BoardManager {
 public:
-  BoardManager(SDL_Renderer *renderer);
+  BoardManager(TextureCache &textures);
 
-  void Update(const float deltaTime, GameContext &context);
-  void Render(SDL_Renderer *renderer);
+  /// Rebuilds the HUD when the score, extra lives or level have changed since
+  /// the last call.
+  void Update(const GameContext &context);
+
+  /// Queues the maze and the cached HUD (score text, extra lives and fruit) on the board layer.
+  void Render(SpriteBatch &batch);
 
 private:
-  void WriteText(SDL_Renderer *renderer, Vec2 position, const std::string &text);
-  void RenderExtraLives(SDL_Renderer *renderer);
-  void RenderFruits(SDL_Renderer *renderer);
+  void BuildHud();
+  void WriteText(Vec2 position, std::string_view text);
+  void AddExtraLives();
+  void AddFruit();
 
   Sprite maze;
   Sprite pacman;
   Sprite fruits;
   Sprite text;
 
-  std::string score;
+  // HUD quads, rebuilt only when a value below changes
+  QuadRun hud;
+  int score{-1};
   int extraLives{0};
   int level{0};
 };
 
-#endif
\ No newline at end of file
+#endif
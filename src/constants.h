@@ -1,6 +1,8 @@
 #ifndef CONSTANTS_H
 #define CONSTANTS_H
 
+#include <array>
+
 #include "vector2.h"
 
 // =============================================================================
@@ -20,6 +22,11 @@ enum class Direction {
 static constexpr std::size_t kFramesPerSecond = 60;
 static constexpr std::size_t kMilliSecondsPerSecond = 1000;
 static constexpr std::size_t kFrameDuration = kMilliSecondsPerSecond / kFramesPerSecond;
+static constexpr std::size_t kMaxFramesPerSecond = 240;
+static constexpr std::size_t kMinFrameDuration = kMilliSecondsPerSecond / kMaxFramesPerSecond;
+static constexpr int kMaxCatchUpSteps = 5;
+static constexpr float kTickSeconds = 1.0f / static_cast<float>(kFramesPerSecond); // reference simulation tick
+static constexpr std::size_t kReplayKeyframeSeconds = 60; // replay keyframe spacing
 
 // =============================================================================
 // Game State Durations (seconds)
@@ -48,6 +55,9 @@ static constexpr int kTotalPellets = 244;
 // =============================================================================
 static constexpr float kMaxSpeed = 75.75757625f;
 static constexpr float kPacmanSpeedMultiplier = 0.8f;
+// Speed tiers, as in the arcade game: level 1, levels 2-4, levels 5-20, then 21 on
+static constexpr std::size_t kSpeedTiers = 4;
+static constexpr std::array<float, kSpeedTiers> kPacmanTierSpeedMultipliers{kPacmanSpeedMultiplier, 0.9f, 1.0f, 0.9f};
 static constexpr float kEnergizerDuration = 6.0f;
 static constexpr Vec2 kPacmanHomeCell = Vec2{13, 26};
 static constexpr Vec2 kPacmanHomePosition =
@@ -56,10 +66,13 @@ static constexpr Vec2 kPacmanHomePosition =
 // =============================================================================
 // Ghost Common
 // =============================================================================
+static constexpr std::size_t kGhostCount = 4;
 static constexpr int kGhostFps = 4;
 static constexpr int kGhostFrameWidth = 16;
 static constexpr float kGhostSpeedMultiplier = 0.73f;
+static constexpr std::array<float, kSpeedTiers> kGhostTierSpeedMultipliers{kGhostSpeedMultiplier, 0.83f, 0.93f, 0.93f};
 static constexpr float kGhostTunnelSpeedMultiplier = 0.5f;
+static constexpr float kGhostRespawnSpeedMultiplier = 2.0f;
 static constexpr float kPenTop = 17.0f * kCellSize;
 static constexpr float kPenBottom = 18.0f * kCellSize;
 
@@ -82,6 +95,23 @@ static constexpr Vec2 kClydeStartCell = Vec2{16, 17};
 static constexpr Vec2 kClydeScatterCell = Vec2{0, 34};
 static constexpr float kClydeRelaxDistance = 8.0f;
 
+// Start cells in GhostPersonalities order; respawning eyes return to them
+static constexpr std::array<Vec2, kGhostCount> kGhostStartCells{kBlinkyStartCell, kInkyStartCell, kPinkyStartCell,
+                                                                kClydeStartCell};
+
+// =============================================================================
+// Sub-stepping
+// =============================================================================
+// Eaten ghosts heading home on the fastest tier are the fastest actors
+static constexpr float kFastestActorSpeed = kMaxSpeed * kGhostTierSpeedMultipliers[2] * kGhostRespawnSpeedMultiplier;
+// Furthest any actor may move per simulation sub-step. Under half a cell, so every
+// actor stops in each cell it passes through, past its centre, before leaving it.
+static constexpr float kMaxSubstepDistance = kCellSize / 2.0f;
+static_assert(kFastestActorSpeed * kTickSeconds <= kMaxSubstepDistance, "a reference tick must stay under half a cell");
+// Slack over kFastestActorSpeed * step that views allow before treating a jump
+// between two ticks as a teleport (tunnel wrap, reset) rather than movement
+static constexpr float kTeleportSlack = kCellSize;
+
 // =============================================================================
 // Audio
 // =============================================================================
@@ -0,0 +1,75 @@
+#ifndef DEFAULT_MAZE_H
+#define DEFAULT_MAZE_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <string_view>
+
+#include "constants.h"
+#include "embedded-maze.h" // generated by CMake from assets/maze.txt
+#include "grid.h"
+
+/// Row and column counts of a maze text, one row per line.
+struct MazeShape {
+  int rows{0};
+  int shortestRow{0};
+  int longestRow{0};
+};
+
+constexpr auto MeasureMaze(std::string_view text) -> MazeShape {
+  MazeShape shape{};
+  while (!text.empty()) {
+    auto end = text.find('\n');
+    auto width = static_cast<int>(end == std::string_view::npos ? text.size() : end);
+
+    shape.shortestRow = shape.rows == 0 ? width : std::min(shape.shortestRow, width);
+    shape.longestRow = std::max(shape.longestRow, width);
+    shape.rows += 1;
+
+    text.remove_prefix(end == std::string_view::npos ? text.size() : end + 1);
+  }
+  return shape;
+}
+
+/// Converts a maze text of kGridHeight rows of kGridWidth symbols into row-major cells.
+constexpr auto ParseMaze(std::string_view text) -> std::array<Cell, kGridCells> {
+  std::array<Cell, kGridCells> cells{};
+  std::size_t index = 0;
+  for (auto symbol : text) {
+    if (symbol != '\n' && index < cells.size()) {
+      cells[index++] = CellFromSymbol(symbol);
+    }
+  }
+  return cells;
+}
+
+constexpr auto CountPellets(const std::array<Cell, kGridCells> &cells) -> int {
+  int count = 0;
+  for (auto cell : cells) {
+    count += (cell == Cell::kPellet || cell == Cell::kPowerPellet) ? 1 : 0;
+  }
+  return count;
+}
+
+inline constexpr MazeShape kDefaultMazeShape = MeasureMaze(kEmbeddedMazeText);
+static_assert(kDefaultMazeShape.rows == kGridHeight, "assets/maze.txt must have kGridHeight rows");
+static_assert(kDefaultMazeShape.shortestRow == kGridWidth && kDefaultMazeShape.longestRow == kGridWidth,
+              "every row of assets/maze.txt must have kGridWidth columns");
+
+/// The arcade maze, compiled in from assets/maze.txt. Starting a game needs no
+/// file I/O, and lookups into it with constant indices fold at compile time.
+inline constexpr std::array<Cell, kGridCells> kDefaultMaze = ParseMaze(kEmbeddedMazeText);
+
+/// Returns the default maze's cell at a cell-unit position such as kPacmanHomeCell.
+constexpr auto DefaultMazeCell(Vec2 cell) -> Cell {
+  return kDefaultMaze[static_cast<std::size_t>(Grid::Index(static_cast<int>(cell.x), static_cast<int>(cell.y)))];
+}
+
+static_assert(CountPellets(kDefaultMaze) == kTotalPellets, "assets/maze.txt must hold kTotalPellets pellets");
+static_assert(DefaultMazeCell(kPacmanHomeCell) != Cell::kWall, "Pacman must start on a walkable cell");
+static_assert(DefaultMazeCell(kBlinkyStartCell) != Cell::kWall && DefaultMazeCell(kInkyStartCell) != Cell::kWall &&
+                  DefaultMazeCell(kPinkyStartCell) != Cell::kWall && DefaultMazeCell(kClydeStartCell) != Cell::kWall,
+              "ghosts must start on walkable cells");
+
+#endif
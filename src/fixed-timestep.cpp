@@ -0,0 +1,31 @@
+#include <stdexcept>
+
+#include "fixed-timestep.h"
+
+FixedTimestep::FixedTimestep(int tickRate, int maxStepsPerFrame)
+    : tickRate_{tickRate}, maxStepsPerFrame_{maxStepsPerFrame} {
+  if (tickRate <= 0 || maxStepsPerFrame <= 0) {
+    throw std::invalid_argument("tick rate and catch-up cap must be positive");
+  }
+  stepSeconds_ = 1.0 / tickRate;
+}
+
+auto FixedTimestep::Advance(double frameSeconds) -> int {
+  if (frameSeconds > 0.0) {
+    accumulator_ += frameSeconds;
+  }
+
+  int steps = 0;
+  while (accumulator_ >= stepSeconds_ && steps < maxStepsPerFrame_) {
+    accumulator_ -= stepSeconds_;
+    steps++;
+  }
+
+  // A long stall (debugger, window drag) would otherwise be replayed over the
+  // following frames. Drop the backlog instead of spiralling.
+  if (steps == maxStepsPerFrame_ && accumulator_ >= stepSeconds_) {
+    accumulator_ = 0.0;
+  }
+
+  return steps;
+}
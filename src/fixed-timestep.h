@@ -0,0 +1,32 @@
+#ifndef FIXED_TIMESTEP_H
+#define FIXED_TIMESTEP_H
+
+/// Accumulates variable frame time and releases it as a whole number of fixed
+/// simulation steps, so game logic always advances by the same delta regardless
+/// of frame jitter. The leftover fraction is exposed for render interpolation.
+class FixedTimestep {
+public:
+  /// @param tickRate Simulation steps per second (e.g. 60, 120, 240)
+  /// @param maxStepsPerFrame Cap on catch-up steps; time beyond it is dropped
+  FixedTimestep(int tickRate, int maxStepsPerFrame);
+
+  /// Adds `frameSeconds` of wall-clock time and returns how many fixed steps to run.
+  auto Advance(double frameSeconds) -> int;
+
+  /// Fixed simulation delta in seconds.
+  auto StepSeconds() const -> float { return static_cast<float>(stepSeconds_); }
+
+  /// Fraction of a step left in the accumulator, in [0, 1). Used to blend the
+  /// previous and current simulation states when rendering.
+  auto Alpha() const -> float { return static_cast<float>(accumulator_ / stepSeconds_); }
+
+  auto TickRate() const -> int { return tickRate_; }
+
+private:
+  int tickRate_;
+  int maxStepsPerFrame_;
+  double stepSeconds_;
+  double accumulator_{0.0};
+};
+
+#endif
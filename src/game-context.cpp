@@ -30,6 +30,12 @@ void GhostWaveManager::Reset() {
   paused_ = false;
 }
 
+void GhostWaveManager::Restore(const GhostWaveSnapshot &snapshot) {
+  currentWave_ = snapshot.currentWave;
+  waveTimer_ = snapshot.waveTimer;
+  paused_ = snapshot.paused;
+}
+
 // GameContext implementation
 
 auto GameContext::NextLevel() -> void {
@@ -42,6 +48,6 @@ auto GameContext::Reset() -> void {
   extraLives = 2;
   level = 0;
   pelletsConsumed = 0;
+  tick = 0;
+  tickCarry = 0.0f;
 }
-
-auto GameContext::LevelComplete() -> bool { return pelletsConsumed >= kTotalPellets; }
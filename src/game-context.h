@@ -2,6 +2,7 @@
 #define GAME_CONTEXT_H
 
 #include <array>
+#include <cstdint>
 #include <utility>
 
 enum class GhostMode {
@@ -11,6 +12,15 @@ enum class GhostMode {
   kReSpawn,
 };
 
+/// Plain-data copy of GhostWaveManager state.
+struct GhostWaveSnapshot {
+  int currentWave;
+  float waveTimer;
+  bool paused;
+
+  auto operator==(const GhostWaveSnapshot &) const -> bool = default;
+};
+
 /// Manages global Scatter/Chase wave timing for all ghosts.
 /// Follows original Pacman wave pattern: Scatter->Chase cycles.
 class GhostWaveManager {
@@ -22,6 +32,9 @@ public:
   auto GetCurrentMode() const -> GhostMode { return kWaves[currentWave_].first; }
   auto IsPaused() const -> bool { return paused_; }
 
+  auto Snapshot() const -> GhostWaveSnapshot { return {currentWave_, waveTimer_, paused_}; }
+  void Restore(const GhostWaveSnapshot &snapshot);
+
 private:
   static constexpr std::array<std::pair<GhostMode, float>, 8> kWaves{{
       {GhostMode::kScatter, 7.0f},
@@ -45,13 +58,16 @@ struct GameContext {
   int level{0};
   int pelletsConsumed{0};
   bool paused{false};
+  std::uint32_t tick{0};  ///< Simulation sub-steps this game; indexes the fixed-point speed patterns
+  float tickCarry{0.0f};   ///< Fixed point: seconds passed to Step that have not yet made up a tick
 
   // pacman, ghosts
   // audio system
 
   auto NextLevel() -> void;
   auto Reset() -> void;
-  auto LevelComplete() -> bool;
+
+  auto operator==(const GameContext &) const -> bool = default;
 };
 
 #endif
\ No newline at end of file
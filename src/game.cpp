@@ -1,3 +1,4 @@
+#include <array>
 #include <iostream>
 
 #include "SDL.h"
@@ -5,6 +6,7 @@
 
 #include "audio-system.h"
 #include "constants.h"
+#include "fixed-timestep.h"
 #include "game.h"
 #include <map>
 
@@ -20,7 +22,7 @@ class GameState {
 public:
   virtual ~GameState() = default;
 
-  // Core state methods
+  // Core state methods. Tick advances the state by one fixed simulation step.
   virtual auto Enter(Game &game) -> void {};
   virtual auto Tick(Game &game, float deltaTime) -> GameStates = 0;
 };
@@ -41,63 +43,82 @@ Game::Game(AssetManager &assetManager) : assetManager{assetManager}, audio{asset
   renderer_ = std::make_shared<Renderer>(kGameWidth * scale, kGameHeight * scale);
   SDL_RenderSetLogicalSize(renderer_->sdl_renderer, kGameWidth, kGameHeight);
 
-  board = std::make_unique<BoardManager>(renderer_->sdl_renderer);
+  board = std::make_unique<BoardManager>(renderer_->Textures());
 
-  pacman = std::make_unique<Pacman>(renderer_->sdl_renderer);
+  simulation_ = std::make_unique<Simulation>(audio);
 
-  auto cells = Grid::Load("../assets/maze.txt");
-  grid = Grid{cells};
-  grid.CreatePellets(renderer_->sdl_renderer);
-
-  createGhosts(renderer_->sdl_renderer);
+  createViews(renderer_->Textures());
 
   ready_ = true;
 }
 
 Game::~Game() { SDL_Quit(); }
 
-auto Game::createGhosts(SDL_Renderer *renderer) -> void {
-  blinky = std::make_shared<Ghost>(BlinkyConfig{renderer});
-  blinky->Activate();
-  ghosts.push_back(blinky);
-
-  auto inky = std::make_shared<Ghost>(InkyConfig{renderer});
-  ghosts.push_back(inky);
+auto Game::createViews(TextureCache &textures) -> void {
+  pacmanView_ = std::make_unique<PacmanView>(textures, actorClock_, simulation_->GetPacman());
+  pellets_ = std::make_unique<PelletLayer>(textures, boardClock_);
 
-  auto pinky = std::make_shared<Ghost>(PinkyConfig{renderer});
-  pinky->Activate();
-  ghosts.push_back(pinky);
+  // Simulation creates the ghosts in this order: Blinky, Inky, Pinky, Clyde.
+  static constexpr std::array<Sprites, 4> kGhostSprites{Sprites::kBlinky, Sprites::kInky, Sprites::kPinky,
+                                                        Sprites::kClyde};
 
-  auto clyde = std::make_shared<Ghost>(ClydeConfig{renderer});
-  ghosts.push_back(clyde);
+  const auto &ghosts = simulation_->GetGhosts();
+  ghostViews_.reserve(ghosts.size());
+  for (size_t i = 0; i < ghosts.size(); ++i) {
+    ghostViews_.emplace_back(textures, actorClock_, kGhostSprites.at(i), ghosts[i]);
+  }
 }
 
 auto Game::Ready() const -> bool { return ready_; }
 
-auto Game::Run(std::size_t target_frame_duration) -> void {
+auto Game::Run(std::size_t tickRate, std::size_t target_frame_duration) -> void {
   Uint32 frame_start{0};
   Uint32 frame_end{0};
   Uint32 frame_duration{0};
 
+  if (replay_) {
+    tickRate = replay_->TickRate();
+  }
+  if (recorder_ == nullptr && !recordPath_.empty()) {
+    recorder_ = std::make_unique<ReplayRecorder>(static_cast<std::uint32_t>(tickRate), 0,
+                                                 static_cast<std::uint32_t>(tickRate * kReplayKeyframeSeconds));
+  }
+
   auto currentState = GameStates::kReady;
   auto states = initializeStates();
 
+  FixedTimestep timestep{static_cast<int>(tickRate), kMaxCatchUpSteps};
+
   states[currentState]->Enter(*this);
+  captureState(timestep.StepSeconds());
 
-  ticks_count_ = SDL_GetTicks();
+  const auto counterFrequency = static_cast<double>(SDL_GetPerformanceFrequency());
+
+  ticks_count_ = SDL_GetPerformanceCounter();
   running_ = true;
 
   while (running_) {
     frame_start = SDL_GetTicks();
-    float deltaTime = static_cast<float>(frame_start - ticks_count_) / 1000.0f;
-    ticks_count_ = SDL_GetTicks();
+    auto now = SDL_GetPerformanceCounter();
+    auto steps = timestep.Advance(static_cast<double>(now - ticks_count_) / counterFrequency);
+    ticks_count_ = now;
+
+    auto keyboard = processInput();
 
-    auto nextState = states[currentState]->Tick(*this, deltaTime);
-    if (nextState != currentState) {
-      currentState = nextState;
-      states[currentState]->Enter(*this);
+    for (int i = 0; i < steps && running_; ++i) {
+      input_ = nextInput(keyboard);
+      auto nextState = states[currentState]->Tick(*this, timestep.StepSeconds());
+      captureState(timestep.StepSeconds());
+
+      if (nextState != currentState) {
+        currentState = nextState;
+        states[currentState]->Enter(*this);
+      }
+      ++tick_;
     }
 
+    render(timestep.Alpha());
+
     frame_end = SDL_GetTicks();
 
     // Keep track of how long each loop through the input/update/render
@@ -111,9 +132,60 @@ auto Game::Run(std::size_t target_frame_duration) -> void {
       SDL_Delay(target_frame_duration - frame_duration);
     }
   }
+
+  finishReplay();
+
+  const auto &rendered = renderer_->Totals();
+  if (rendered.frames > 0) {
+    auto frames = static_cast<double>(rendered.frames);
+    std::cout << "Rendered " << rendered.frames << " frames: " << static_cast<double>(rendered.drawCalls) / frames
+              << " draw calls and " << static_cast<double>(rendered.sprites) / frames << " sprites per frame\n";
+  }
+
+  const auto &textures = renderer_->Textures().Stats();
+  std::cout << "Textures: " << textures.decodes << " sheets decoded, " << textures.uploads << " uploaded, "
+            << textures.acquires << " handles, " << textures.bytes / 1024 << " KiB alive (peak "
+            << textures.peakBytes / 1024 << " KiB)\n";
+}
+
+auto Game::RecordTo(const std::string &path) -> void { recordPath_ = path; }
+
+auto Game::PlayFrom(const std::string &path) -> void { replay_ = std::make_unique<ReplayReader>(path); }
+
+auto Game::nextInput(const TickInput &keyboard) -> TickInput {
+  auto input = keyboard;
+
+  if (replay_) {
+    if (const auto *keyframe = replay_->KeyframeAt(tick_);
+        keyframe != nullptr && !(keyframe->snapshot == simulation_->Snapshot())) {
+      std::cerr << "Replay diverged from the recording at tick " << tick_ << "\n";
+      replayMismatches_ += 1;
+    }
+
+    input = replay_->InputAt(tick_);
+    if (tick_ + 1 >= replay_->TickCount()) {
+      running_ = false;
+    }
+  }
+
+  if (recorder_) {
+    recorder_->Append(input, *simulation_);
+  }
+
+  return input;
+}
+
+auto Game::finishReplay() -> void {
+  if (replay_) {
+    std::cout << "Replayed " << tick_ << " ticks with " << replayMismatches_ << " keyframe mismatches\n";
+  }
+  if (recorder_) {
+    recorder_->Save(recordPath_);
+    std::cout << "Recorded " << recorder_->TickCount() << " ticks to " << recordPath_ << "\n";
+  }
 }
 
-auto Game::processInput() -> const Uint8 * {
+auto Game::processInput() -> TickInput {
   SDL_Event event;
   while (SDL_PollEvent(&event)) {
     switch (event.type) {
@@ -138,38 +210,61 @@ auto Game::processInput() -> const Uint8 * {
     running_ = false;
   }
 
-  return state;
+  TickInput input{.heading = Direction::kNeutral, .pause = state[SDL_SCANCODE_P] != 0u};
+  if (state[SDL_SCANCODE_RIGHT]) {
+    input.heading = Direction::kEast;
+  } else if (state[SDL_SCANCODE_LEFT]) {
+    input.heading = Direction::kWest;
+  } else if (state[SDL_SCANCODE_UP]) {
+    input.heading = Direction::kNorth;
+  } else if (state[SDL_SCANCODE_DOWN]) {
+    input.heading = Direction::kSouth;
+  }
+
+  return input;
 }
 
-auto Game::update(const float deltaTime) -> void {
-  updateEntities(deltaTime);
+auto Game::update(const float deltaTime) -> SimulationStatus {
+  auto status = updateEntities(deltaTime);
   updateAnimations(deltaTime);
+  return status;
 }
 
-auto Game::updateEntities(const float deltaTime) -> void {
-  waveManager_.Update(deltaTime);
-  pacman->Update(deltaTime, grid, context, audio, ghosts);
-  for (auto &ghost : ghosts) {
-    ghost->Update(deltaTime, grid, context, *pacman, *blinky, waveManager_);
+auto Game::updateEntities(const float deltaTime) -> SimulationStatus {
+  auto status = simulation_->Step(deltaTime);
+
+  actorClock_.Advance(deltaTime);
+  pacmanView_->Update();
+  for (auto &view : ghostViews_) {
+    view.Update();
   }
+  return status;
 }
 
 auto Game::updateAnimations(const float deltaTime) -> void {
-  grid.Update(deltaTime);
-  board->Update(deltaTime, context);
+  boardClock_.Advance(deltaTime);
+  board->Update(simulation_->GetContext());
+}
+
+auto Game::captureState(float stepSeconds) -> void {
+  pacmanView_->Capture(stepSeconds);
+  for (auto &view : ghostViews_) {
+    view.Capture(stepSeconds);
+  }
 }
 
-auto Game::render() -> void {
+auto Game::render(float alpha) -> void {
   renderer_->Clear();
 
-  board->Render(renderer_->sdl_renderer);
-  grid.Render(renderer_->sdl_renderer);
+  auto &batch = renderer_->Batch();
+  board->Render(batch);
+  pellets_->Render(batch, simulation_->GetGrid());
 
-  for (auto &ghost : ghosts) {
-    ghost->Render(renderer_->sdl_renderer);
+  for (auto &view : ghostViews_) {
+    view.Render(batch, alpha);
   }
 
-  pacman->Render(renderer_->sdl_renderer);
+  pacmanView_->Render(batch, alpha);
 
   renderer_->Present();
 }
@@ -190,19 +285,9 @@ auto Game::GetTexture(const std::string &fileName) const -> SDL_Texture * {
 
 auto Game::GetScore() const -> int { return score; }
 
-auto Game::Pause() -> void {
-  pacman->Pause();
-  for (auto &ghost : ghosts) {
-    ghost->Pause();
-  }
-}
+auto Game::Pause() -> void { simulation_->Pause(); }
 
-auto Game::Resume() -> void {
-  pacman->Resume();
-  for (auto &ghost : ghosts) {
-    ghost->Resume();
-  }
-}
+auto Game::Resume() -> void { simulation_->Resume(); }
 
 auto Game::PlaySound(Sounds sound) -> void {
   [[maybe_unused]] auto [handle, future] = audio.PlaySound(sound, std::nullopt);
@@ -219,15 +304,12 @@ auto Game::PlaySound(Sounds sound) -> void {
 struct ReadyState : GameState {
   auto Enter(Game &game) -> void override {
     elapsedTime = 0.0f;
-    game.pacman->Reset();
-    game.waveManager_.Reset();
+    game.simulation_->Restart();
     game.PlaySound(Sounds::kIntro);
   }
 
   auto Tick(Game &game, float deltaTime) -> GameStates override {
-    game.processInput();
     game.updateAnimations(deltaTime);
-    game.render();
 
     if (elapsedTime >= kReadyStateDuration) {
       return GameStates::kPlay;
@@ -243,39 +325,26 @@ private:
 };
 
 struct PlayState : GameState {
-  auto Enter(Game &game) -> void override { game.waveManager_.Resume(); }
+  auto Enter(Game &game) -> void override { game.simulation_->GetWaveManager().Resume(); }
 
   auto Tick(Game &game, float deltaTime) -> GameStates override {
-    auto keyState = game.processInput();
-    game.pacman->ProcessInput(keyState);
+    game.simulation_->ProcessInput(game.input_.heading);
 
-    game.update(deltaTime);
-    game.render();
+    auto status = game.update(deltaTime);
 
-    if (pauseRequested(keyState)) {
+    if (game.input_.pause) {
       return GameStates::kPaused;
-    } else if (levelCompleted(game)) {
+    }
+
+    switch (status) {
+    case SimulationStatus::kLevelComplete:
       return GameStates::kLevelComplete;
-    } else if (wasKilled(game)) {
+    case SimulationStatus::kPacmanKilled:
       return GameStates::kDying;
-    } else {
+    default:
       return GameStates::kPlay;
     }
   }
-
-private:
-  auto pauseRequested(const Uint8 *keyState) const -> bool { return keyState[SDL_SCANCODE_P] != 0u; }
-
-  auto levelCompleted(Game &game) const -> bool { return game.context.LevelComplete(); }
-
-  auto wasKilled(Game &game) const -> bool {
-    for (auto &ghost : game.ghosts) {
-      if (ghost->CanKill() && (ghost->GetCell() == game.pacman->GetCell())) {
-        return true;
-      }
-    }
-    return false;
-  }
 };
 
 struct PausedState : GameState {
@@ -283,11 +352,9 @@ struct PausedState : GameState {
   auto Enter(Game &game) -> void override { pause(game); }
 
   auto Tick(Game &game, float deltaTime) -> GameStates override {
-    auto keyState = game.processInput();
     game.update(deltaTime);
-    game.render();
 
-    if (resumeRequested(keyState)) {
+    if (game.input_.pause) {
       resume(game);
       return GameStates::kPlay;
     } else {
@@ -296,43 +363,27 @@ struct PausedState : GameState {
   }
 
 private:
-  auto pause(Game &game) const -> void {
-    game.waveManager_.Pause();
-    game.pacman->Pause();
-    for (auto &ghost : game.ghosts) {
-      ghost->Pause();
-    }
-  }
-
-  auto resume(Game &game) const -> void {
-    game.waveManager_.Resume();
-    game.pacman->Resume();
-    for (auto &ghost : game.ghosts) {
-      ghost->Resume();
-    }
-  }
+  auto pause(Game &game) const -> void { game.Pause(); }
 
-  auto resumeRequested(const Uint8 *keyState) const -> bool { return keyState[SDL_SCANCODE_P] != 0u; }
+  auto resume(Game &game) const -> void { game.Resume(); }
 };
 
 struct DyingState : GameState {
   auto Enter(Game &game) -> void override {
     std::cout << "Entering Dying State\n";
     elapsedTime = 0.0f;
-    game.waveManager_.Pause();
+    game.simulation_->GetWaveManager().Pause();
     game.PlaySound(Sounds::kDeath);
-    game.context.extraLives -= 1;
+    game.simulation_->GetContext().extraLives -= 1;
   }
 
   auto Tick(Game &game, float deltaTime) -> GameStates override {
-    game.processInput();
     game.updateAnimations(deltaTime);
-    game.render();
 
     if (elapsedTime >= kDyingStateDuration) {
-      reset(game);
+      game.simulation_->ResetActors();
 
-      if (game.context.extraLives < 0) {
+      if (game.simulation_->GetContext().extraLives < 0) {
         return GameStates::kReady;
       }
 
@@ -345,14 +396,6 @@ struct DyingState : GameState {
   }
 
 private:
-  auto reset(Game &game) const -> void {
-    game.pacman->Reset();
-
-    for (auto &ghost : game.ghosts) {
-      ghost->Reset();
-    }
-  }
-
   float elapsedTime{0.0f};
 };
 
@@ -360,14 +403,12 @@ struct LevelCompleteState : GameState {
   auto Enter(Game &game) -> void override {
     std::cout << "Entering Level Complete State\n";
     elapsedTime = 0.0f;
-    game.waveManager_.Pause();
+    game.simulation_->GetWaveManager().Pause();
     game.audio.CancelAllSounds();
   }
 
   auto Tick(Game &game, float deltaTime) -> GameStates override {
-    game.processInput();
     game.updateAnimations(deltaTime);
-    game.render();
 
     if (elapsedTime > kLevelCompleteStateDuration) {
       completeLevel(game);
@@ -381,14 +422,8 @@ struct LevelCompleteState : GameState {
 
 private:
   auto completeLevel(Game &game) const -> void {
-    game.grid.Reset(game.renderer_->sdl_renderer);
-    game.pacman->Reset();
-    game.waveManager_.Reset();
-    game.context.NextLevel();
-
-    for (auto &ghost : game.ghosts) {
-      ghost->Reset();
-    }
+    game.simulation_->NextLevel();
+    game.pellets_->Reset();
   }
 
   float elapsedTime{0.0f};
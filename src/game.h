@@ -7,15 +7,16 @@
 
 #include "SDL.h"
 
+#include "animation.h"
 #include "asset-manager.h"
 #include "audio-system.h"
 #include "board-manager.h"
-#include "game-context.h"
-#include "ghost.h"
-#include "grid.h"
-#include "pacman.h"
+#include "ghost-view.h"
+#include "pacman-view.h"
 #include "pellet.h"
 #include "renderer.h"
+#include "replay.h"
+#include "simulation.h"
 
 /// Main game orchestrator managing the game loop, entities, and subsystems.
 /// Uses a state machine pattern (Ready, Play, Paused, Dying, LevelComplete).
@@ -30,9 +31,20 @@ public:
   /// Cleans up SDL resources.
   ~Game();
 
-  /// Runs the main game loop (input -> update -> render).
-  /// @param targetFrameDuration Target frame duration in milliseconds
-  auto Run(std::size_t targetFrameDuration) -> void;
+  /// Runs the main game loop. Input is polled once per frame, the simulation
+  /// advances in fixed steps of 1/tickRate seconds, and rendering interpolates
+  /// between the last two simulation states.
+  /// @param tickRate Simulation steps per second
+  /// @param targetFrameDuration Minimum frame duration in milliseconds
+  auto Run(std::size_t tickRate, std::size_t targetFrameDuration) -> void;
+
+  /// Records the input of every tick and writes it to `path` when Run returns.
+  auto RecordTo(const std::string &path) -> void;
+
+  /// Replays the ticks recorded in `path` instead of reading the keyboard. Run
+  /// uses the recorded tick rate, checks the world against each keyframe and
+  /// returns once the recording ends. Throws std::runtime_error on a bad file.
+  auto PlayFrom(const std::string &path) -> void;
 
   /// Returns the current score.
   auto GetScore() const -> int;
@@ -49,41 +61,53 @@ public:
   friend struct DyingState;
   friend struct LevelCompleteState;
 
-  /// Pauses all entity animations.
+  /// Pauses wave timing and all entities.
   auto Pause() -> void;
 
-  /// Resumes all entity animations.
+  /// Resumes wave timing and all entities.
   auto Resume() -> void;
 
   /// Plays a sound effect asynchronously.
   auto PlaySound(Sounds sound) -> void;
 
 private:
-  const Uint8 *processInput();
-  void update(const float deltaTime);
-  void updateEntities(const float deltaTime);
+  auto processInput() -> TickInput;
+  auto nextInput(const TickInput &keyboard) -> TickInput;
+  auto finishReplay() -> void;
+  auto update(const float deltaTime) -> SimulationStatus;
+  auto updateEntities(const float deltaTime) -> SimulationStatus;
   void updateAnimations(const float deltaTime);
-  void render();
+  void captureState(float stepSeconds);
+  void render(float alpha);
 
-  void createGhosts(SDL_Renderer *renderer);
+  void createViews(TextureCache &textures);
 
   int score{0}; // game score
 
   bool ready_{false};   // initialization flag
   bool running_{false}; // running flag
   std::shared_ptr<Renderer> renderer_;
-  Uint32 ticks_count_{0};
+  Uint64 ticks_count_{0};
+  TickInput input_{}; // input applied during the current tick
+  std::uint64_t tick_{0};
+
+  std::unique_ptr<ReplayRecorder> recorder_;
+  std::string recordPath_;
+  std::unique_ptr<ReplayReader> replay_;
+  int replayMismatches_{0};
+
+  // Actors animate only while the simulation runs; the board animates in every state
+  AnimationClock actorClock_;
+  AnimationClock boardClock_;
 
-  std::unique_ptr<Pacman> pacman;
-  Grid grid{};
   std::unique_ptr<BoardManager> board;
-  std::vector<std::shared_ptr<Ghost>> ghosts;
-  std::shared_ptr<Ghost> blinky;
-  GameContext context{};
-  GhostWaveManager waveManager_{};
+  std::unique_ptr<PacmanView> pacmanView_;
+  std::vector<GhostView> ghostViews_;
+  std::unique_ptr<PelletLayer> pellets_;
 
   AssetManager &assetManager;
   AudioSystem audio;
+  std::unique_ptr<Simulation> simulation_;
 };
 
 #endif
@@ -0,0 +1,137 @@
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+
+#include "ghost-steering.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define PACMAN_STEERING_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+constexpr float kInfinity = std::numeric_limits<float>::infinity();
+
+// Portable path, also used for batch tails. Squared distances order moves the
+// same way Vec2::Distance does, without pow or sqrt.
+auto steerScalar(float cellX, float cellY, float targetX, float targetY, MoveMask open) -> Direction {
+  auto best = Direction::kNeutral;
+  auto bestDistance = kInfinity;
+  for (std::size_t i = 0; i < kMoveHeadings.size(); ++i) {
+    if ((open & (1u << i)) == 0) {
+      continue;
+    }
+    auto dx = cellX + kSteeringOffsetX[i] - targetX;
+    auto dy = cellY + kSteeringOffsetY[i] - targetY;
+    auto distance = dx * dx + dy * dy;
+    if (distance < bestDistance) {
+      best = kMoveHeadings[i];
+      bestDistance = distance;
+    }
+  }
+  return best;
+}
+
+} // namespace
+
+auto SteeringBatch::Resize(std::size_t ghosts) -> void {
+  cellX.resize(ghosts);
+  cellY.resize(ghosts);
+  targetX.resize(ghosts);
+  targetY.resize(ghosts);
+  open.resize(ghosts);
+}
+
+#if defined(PACMAN_STEERING_SSE2)
+
+auto SteerTowards(const Vec2 &cell, const Vec2 &target, MoveMask open) -> Direction {
+  if (open == 0) {
+    return Direction::kNeutral;
+  }
+
+  // One lane per move, in kMoveHeadings order
+  const __m128 dx = _mm_sub_ps(_mm_add_ps(_mm_set1_ps(cell.x), _mm_loadu_ps(kSteeringOffsetX.data())),
+                               _mm_set1_ps(target.x));
+  const __m128 dy = _mm_sub_ps(_mm_add_ps(_mm_set1_ps(cell.y), _mm_loadu_ps(kSteeringOffsetY.data())),
+                               _mm_set1_ps(target.y));
+  const __m128 distance = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+
+  const __m128i bits = _mm_setr_epi32(1, 2, 4, 8);
+  const __m128 isOpen = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(_mm_set1_epi32(open), bits), bits));
+  const __m128 masked = _mm_or_ps(_mm_and_ps(isOpen, distance), _mm_andnot_ps(isOpen, _mm_set1_ps(kInfinity)));
+
+  // Horizontal minimum, then the first open lane that holds it
+  __m128 minimum = _mm_min_ps(masked, _mm_shuffle_ps(masked, masked, _MM_SHUFFLE(2, 3, 0, 1)));
+  minimum = _mm_min_ps(minimum, _mm_shuffle_ps(minimum, minimum, _MM_SHUFFLE(1, 0, 3, 2)));
+  auto lanes = static_cast<unsigned>(_mm_movemask_ps(_mm_cmpeq_ps(masked, minimum))) & open;
+
+  return kMoveHeadings[static_cast<std::size_t>(std::countr_zero(lanes))];
+}
+
+auto SteerTowards(const SteeringLanes &batch, std::span<Direction> headings) -> void {
+  if (headings.size() != batch.Size()) {
+    throw std::invalid_argument("SteerTowards needs one heading per ghost");
+  }
+
+  // Four ghosts per iteration, one per lane; the four moves are unrolled
+  const auto count = batch.Size();
+  std::size_t ghost = 0;
+  for (; ghost + 4 <= count; ghost += 4) {
+    const __m128 cellX = _mm_loadu_ps(&batch.cellX[ghost]);
+    const __m128 cellY = _mm_loadu_ps(&batch.cellY[ghost]);
+    const __m128 targetX = _mm_loadu_ps(&batch.targetX[ghost]);
+    const __m128 targetY = _mm_loadu_ps(&batch.targetY[ghost]);
+    const __m128i open = _mm_setr_epi32(batch.open[ghost], batch.open[ghost + 1], batch.open[ghost + 2],
+                                        batch.open[ghost + 3]);
+
+    __m128 best = _mm_set1_ps(kInfinity);
+    __m128i bestMove = _mm_set1_epi32(-1);
+    for (int move = 0; move < 4; ++move) {
+      const __m128 dx = _mm_sub_ps(_mm_add_ps(cellX, _mm_set1_ps(kSteeringOffsetX[move])), targetX);
+      const __m128 dy = _mm_sub_ps(_mm_add_ps(cellY, _mm_set1_ps(kSteeringOffsetY[move])), targetY);
+      const __m128 distance = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+
+      const __m128i bit = _mm_set1_epi32(1 << move);
+      const __m128 isOpen = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(open, bit), bit));
+      const __m128 closer = _mm_and_ps(_mm_cmplt_ps(distance, best), isOpen);
+
+      best = _mm_or_ps(_mm_and_ps(closer, distance), _mm_andnot_ps(closer, best));
+      const __m128i take = _mm_castps_si128(closer);
+      bestMove = _mm_or_si128(_mm_and_si128(take, _mm_set1_epi32(move)), _mm_andnot_si128(take, bestMove));
+    }
+
+    alignas(16) std::int32_t moves[4];
+    _mm_store_si128(reinterpret_cast<__m128i *>(moves), bestMove);
+    for (std::size_t lane = 0; lane < 4; ++lane) {
+      headings[ghost + lane] =
+          moves[lane] < 0 ? Direction::kNeutral : kMoveHeadings[static_cast<std::size_t>(moves[lane])];
+    }
+  }
+
+  for (; ghost < count; ++ghost) {
+    headings[ghost] =
+        steerScalar(batch.cellX[ghost], batch.cellY[ghost], batch.targetX[ghost], batch.targetY[ghost], batch.open[ghost]);
+  }
+}
+
+#else
+
+auto SteerTowards(const Vec2 &cell, const Vec2 &target, MoveMask open) -> Direction {
+  return steerScalar(cell.x, cell.y, target.x, target.y, open);
+}
+
+auto SteerTowards(const SteeringLanes &batch, std::span<Direction> headings) -> void {
+  if (headings.size() != batch.Size()) {
+    throw std::invalid_argument("SteerTowards needs one heading per ghost");
+  }
+
+  // Written as independent per-ghost loops so compilers can vectorise it
+  for (std::size_t ghost = 0; ghost < batch.Size(); ++ghost) {
+    headings[ghost] =
+        steerScalar(batch.cellX[ghost], batch.cellY[ghost], batch.targetX[ghost], batch.targetY[ghost], batch.open[ghost]);
+  }
+}
+
+#endif
@@ -0,0 +1,89 @@
+#ifndef GHOST_STEERING_H
+#define GHOST_STEERING_H
+
+#include <array>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include "constants.h"
+#include "grid.h"
+#include "vector2.h"
+
+/// Cell offsets of kMoveHeadings, as floats for the SIMD lanes.
+inline constexpr std::array<float, 4> kSteeringOffsetX{0.0f, 0.0f, 1.0f, -1.0f};
+inline constexpr std::array<float, 4> kSteeringOffsetY{-1.0f, 1.0f, 0.0f, 0.0f};
+
+/// Returns the open move whose next cell is closest to `target`, comparing
+/// squared distances of all four moves at once. Ties go to the earlier move in
+/// kMoveHeadings. Returns kNeutral when no move is open.
+auto SteerTowards(const Vec2 &cell, const Vec2 &target, MoveMask open) -> Direction;
+
+/// One ghost's intersection choice: its cell, its target and the open moves.
+/// No open moves means the ghost has no choice to make this update.
+struct SteeringInput {
+  Vec2 cell{};
+  Vec2 target{};
+  MoveMask open{0};
+};
+
+/// Read-only struct-of-arrays view of steering inputs, one entry per ghost, over
+/// whichever storage a BasicSteeringBatch uses.
+struct SteeringLanes {
+  std::span<const float> cellX;
+  std::span<const float> cellY;
+  std::span<const float> targetX;
+  std::span<const float> targetY;
+  std::span<const MoveMask> open;
+
+  auto Size() const -> std::size_t { return cellX.size(); }
+};
+
+/// Struct-of-arrays steering inputs for many ghosts, one entry per ghost, stored
+/// in `Floats` and `Masks` (std::vector or std::array). A ghost with no open moves
+/// gets kNeutral, so lanes that have no choice to make this update are filled with
+/// `open` = 0.
+template <typename Floats, typename Masks>
+struct BasicSteeringBatch {
+  Floats cellX{};
+  Floats cellY{};
+  Floats targetX{};
+  Floats targetY{};
+  Masks open{};
+
+  auto Size() const -> std::size_t { return cellX.size(); }
+
+  auto Set(std::size_t lane, const SteeringInput &input) -> void {
+    cellX[lane] = input.cell.x;
+    cellY[lane] = input.cell.y;
+    targetX[lane] = input.target.x;
+    targetY[lane] = input.target.y;
+    open[lane] = input.open;
+  }
+
+  auto Lanes() const -> SteeringLanes { return {cellX, cellY, targetX, targetY, open}; }
+};
+
+/// Steering lanes for any number of ghosts, on the heap.
+struct SteeringBatch : BasicSteeringBatch<std::vector<float>, std::vector<MoveMask>> {
+  SteeringBatch() = default;
+  explicit SteeringBatch(std::size_t ghosts) { Resize(ghosts); }
+
+  auto Resize(std::size_t ghosts) -> void;
+};
+
+/// Steering lanes for a fixed number of ghosts, held inline so the owner needs no
+/// heap blocks; Simulation uses one per game.
+template <std::size_t Ghosts>
+using FixedSteeringBatch = BasicSteeringBatch<std::array<float, Ghosts>, std::array<MoveMask, Ghosts>>;
+
+/// SteerTowards for every ghost in `lanes`, several ghosts per SIMD instruction.
+/// `headings` must hold lanes.Size() entries.
+auto SteerTowards(const SteeringLanes &lanes, std::span<Direction> headings) -> void;
+
+template <typename Floats, typename Masks>
+auto SteerTowards(const BasicSteeringBatch<Floats, Masks> &batch, std::span<Direction> headings) -> void {
+  SteerTowards(batch.Lanes(), headings);
+}
+
+#endif
@@ -0,0 +1,48 @@
+#include <cmath>
+
+#include "ghost-view.h"
+
+GhostView::GhostView(TextureCache &textures, const AnimationClock &clock, Sprites sprite, const Ghost &ghost)
+    : ghost_{ghost}, heading_{ghost.GetHeading()}, previous_{ghost.GetPosition()}, current_{ghost.GetPosition()},
+      sprite_{textures, sprite, clock, Clip::kGhostNeutral, kGhostFrameWidth},
+      scaredSprite_{textures, Sprites::kScaredGhost, clock, Clip::kStill, kGhostFrameWidth},
+      respawnSprite_{textures, Sprites::kGhostEyes, clock, Clip::kEyesNeutral, kGhostFrameWidth} {
+  setClipsForHeading(heading_);
+}
+
+void GhostView::Update() {
+  if (ghost_.GetHeading() != heading_) {
+    heading_ = ghost_.GetHeading();
+    setClipsForHeading(heading_);
+  }
+}
+
+void GhostView::Capture(float stepSeconds) {
+  previous_ = current_;
+  current_ = ghost_.GetPosition();
+  // Tunnel wraps and resets move further than any actor can travel in a step
+  teleported_ = previous_.Distance(current_) > kFastestActorSpeed * stepSeconds + kTeleportSlack;
+}
+
+void GhostView::Render(SpriteBatch &batch, float alpha) {
+  // Teleports are drawn at the new position rather than swept across the maze
+  auto position = teleported_ ? current_ : Lerp(previous_, current_, alpha);
+  Vec2 renderPos{std::floor(position.x - kCellSize), std::floor(position.y - kCellSize)};
+
+  if (ghost_.IsScared()) {
+    scaredSprite_.Render(batch, RenderLayer::kActors, renderPos);
+  } else if (ghost_.IsRespawning()) {
+    respawnSprite_.Render(batch, RenderLayer::kActors, renderPos);
+  } else {
+    sprite_.Render(batch, RenderLayer::kActors, renderPos);
+  }
+}
+
+void GhostView::setClipsForHeading(Direction heading) {
+  sprite_.SetClip(ForHeading(Clip::kGhostNeutral, heading));
+
+  // Eyes keep their last heading while the ghost has none
+  if (heading != Direction::kNeutral) {
+    respawnSprite_.SetClip(ForHeading(Clip::kEyesNeutral, heading));
+  }
+}
@@ -0,0 +1,45 @@
+#ifndef GHOST_VIEW_H
+#define GHOST_VIEW_H
+
+#include "animation.h"
+#include "asset-registry.h"
+#include "constants.h"
+#include "ghost.h"
+#include "texture-cache.h"
+#include "sprite-batch.h"
+#include "sprite.h"
+
+/// Draws a Ghost. Holds the body, scared and eyes sprites and keeps their clips in
+/// step with the ghost's heading.
+class GhostView {
+public:
+  /// @param clock Clock the ghost animates on
+  /// @param sprite Body sprite sheet for this ghost's personality
+  GhostView(TextureCache &textures, const AnimationClock &clock, Sprites sprite, const Ghost &ghost);
+
+  /// Switches clips if the ghost's heading has changed.
+  void Update();
+
+  /// Records the ghost's position after a simulation step.
+  /// @param stepSeconds Length of the step just taken
+  void Capture(float stepSeconds);
+
+  /// Queues the ghost, between the last two captured positions, on the actors layer.
+  /// @param alpha Interpolation factor in [0, 1]
+  void Render(SpriteBatch &batch, float alpha);
+
+private:
+  void setClipsForHeading(Direction heading);
+
+  const Ghost &ghost_;
+  Direction heading_;
+  Vec2 previous_;
+  Vec2 current_;
+  bool teleported_{false};
+
+  Sprite sprite_;
+  Sprite scaredSprite_;
+  Sprite respawnSprite_;
+};
+
+#endif
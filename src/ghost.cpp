@@ -1,18 +1,10 @@
+#include <bit>
+#include <cmath>
 #include <iostream>
 
 #include "constants.h"
 #include "ghost.h"
-
-static constexpr std::array<Candidate, 4> options{
-    Candidate{.position = {.x = 0, .y = -1}, .heading = Direction::kNorth},
-    Candidate{.position = {.x = 0, .y = 1}, .heading = Direction::kSouth},
-    Candidate{.position = {.x = 1, .y = 0}, .heading = Direction::kEast},
-    Candidate{.position = {.x = -1, .y = 0}, .heading = Direction::kWest},
-};
-
-auto center(float pos) -> float;
-auto boundUpper(float pos) -> float;
-auto boundLower(float pos) -> float;
+#include "movement.h"
 
 auto reverseDirection(Direction direction) -> Direction {
   switch (direction) {
@@ -29,54 +21,116 @@ auto reverseDirection(Direction direction) -> Direction {
   }
 }
 
-auto toCell(const Vec2 &position) -> Vec2 {
-  auto t = position / kCellSize;
-  return {.x = floor(t.x), .y = floor(t.y)};
+namespace {
+
+auto inTunnel(const Vec2 &cell) -> bool { return cell.y == kTunnelRow && (cell.x < 4 || cell.x > 22); }
+
+/// One value of each state, indexed by GhostStateType. States are empty, so
+/// entering one is a copy of a tag.
+constexpr std::array<GhostState, std::variant_size_v<GhostState>> kStates{
+    PennedState{}, ExitingPenState{}, ChaseState{}, ScatterState{}, ScaredState{}, RespawningState{},
+};
+
+constexpr auto statesInOrder() -> bool {
+  for (std::size_t i = 0; i < kStates.size(); ++i) {
+    if (std::visit([](const auto &state) { return state.kType; }, kStates[i]) != static_cast<GhostStateType>(i)) {
+      return false;
+    }
+  }
+  return true;
 }
 
-Ghost::Ghost(const GhostConfig &config)
-    : initialPosition_{config.GetInitialPosition()}, heading_{config.GetInitialHeading()},
-      targeter_{config.GetTargeter()}, scatterCell_{config.GetScatterCell()}, sprite_{config.GetSprite()},
-      scaredSprite_{config.GetScaredSprite()}, respawnSprite_{config.GetRespawnSprite()} {
+static_assert(statesInOrder(), "GhostState alternatives must follow GhostStateType order");
+
+} // namespace
+
+Ghost::Ghost(std::size_t personality, Vec2 startCell, Vec2 scatterCell, Direction heading)
+    : personality_{static_cast<std::uint8_t>(personality)},
+      initialPosition_{ToPosition({.x = startCell.x * kCellSize, .y = startCell.y * kCellSize + (kCellSize / 2)})},
+      heading_{heading}, scatterCell_{scatterCell} {
   position_ = initialPosition_;
-  SetFramesForHeading(heading_);
 
   // Initialize state based on starting position
-  if (IsInPen()) {
-    stateType_ = GhostStateType::kPenned;
-  } else {
-    stateType_ = GhostStateType::kScatter;
-  }
-  state_ = createState(stateType_);
-  state_->Enter(*this, stateType_); // Initial state, no previous
+  auto initial = IsInPen() ? GhostStateType::kPenned : GhostStateType::kScatter;
+  enterState(initial, initial); // Initial state, no previous
 }
 
 void Ghost::Update(float deltaTime, Grid &grid, GameContext &context, Pacman &pacman, Ghost &blinky,
-                   GhostWaveManager &waveManager) {
-  UpdateContext ctx{grid, context, pacman, blinky, waveManager};
+                   GhostWaveManager &waveManager, Direction steering) {
+  UpdateContext ctx{grid, context, pacman, blinky, waveManager, steering,
+                    StridesFor(context.level, context.tick, deltaTime)};
 
-  auto nextState = state_->Update(*this, deltaTime, ctx);
-  if (nextState != stateType_) {
-    TransitionTo(nextState);
+  // One branch on the personality; everything below it is specialised for it
+  GhostPersonalities::Visit(personality_, [&]<GhostPersonality Personality>() { update<Personality>(ctx); });
+}
+
+auto Ghost::PlanSteering(const Grid &grid, const Pacman &pacman, const Ghost &blinky) const -> SteeringInput {
+  // Mirrors the choice UpdateMovement makes for the states that steer
+  const auto type = GetStateType();
+  const auto cell = GetCell();
+  if ((type != GhostStateType::kChase && type != GhostStateType::kScatter && type != GhostStateType::kScared) ||
+      inTunnel(cell) || !InCellCenter()) {
+    return {};
   }
+  auto open = OpenMoves(grid, cell);
+  if (open == 0 || std::has_single_bit(open)) {
+    return {};
+  }
+
+  SteeringInput input{.cell = cell, .target = {}, .open = open};
+  GhostPersonalities::Visit(personality_, [&]<GhostPersonality Personality>() {
+    input.target =
+        type == GhostStateType::kChase ? Personality::ChaseTarget(*this, pacman, blinky) : Personality::kScatterCell;
+  });
+  return input;
+}
 
-  sprite_->Update(deltaTime);
-  scaredSprite_->Update(deltaTime);
-  respawnSprite_->Update(deltaTime);
+template <GhostPersonality Personality>
+void Ghost::update(const UpdateContext &ctx) {
+  auto nextState = std::visit([&](auto &state) { return state.template Update<Personality>(*this, ctx); }, state_);
+  if (nextState != GetStateType()) {
+    TransitionTo(nextState);
+  }
 }
 
 void Ghost::TransitionTo(GhostStateType newState) {
+  auto fromState = GetStateType();
+
   // Track previous active state for returning from Scared/Respawn
-  if (stateType_ == GhostStateType::kChase || stateType_ == GhostStateType::kScatter) {
-    previousActiveState_ = stateType_;
+  if (fromState == GhostStateType::kChase || fromState == GhostStateType::kScatter) {
+    previousActiveState_ = fromState;
   }
-  auto fromState = stateType_;
-  stateType_ = newState;
-  state_ = createState(newState);
-  state_->Enter(*this, fromState);
+  enterState(newState, fromState);
 }
 
-// createState is defined after state classes below
+void Ghost::enterState(GhostStateType type, GhostStateType fromState) {
+  state_ = kStates[static_cast<std::size_t>(type)];
+  std::visit([&](auto &state) { state.Enter(*this, fromState); }, state_);
+}
+
+auto Ghost::Snapshot() const -> GhostSnapshot {
+  return {.position = ToVec2(position_),
+          .velocity = velocity_,
+          .heading = heading_,
+          .previousHeading = previousHeading_,
+          .previousCell = previousCell_,
+          .stateType = GetStateType(),
+          .previousActiveState = previousActiveState_,
+          .active = active_};
+}
+
+void Ghost::Restore(const GhostSnapshot &snapshot) {
+  position_ = ToPosition(snapshot.position);
+  velocity_ = snapshot.velocity;
+  heading_ = snapshot.heading;
+  previousHeading_ = snapshot.previousHeading;
+  previousCell_ = snapshot.previousCell;
+  previousActiveState_ = snapshot.previousActiveState;
+  active_ = snapshot.active;
+
+  // Enter() is not called: its side effects are already part of the snapshot
+  state_ = kStates[static_cast<std::size_t>(snapshot.stateType)];
+}
 
 auto Ghost::Pause() -> void {}
 
@@ -103,42 +157,25 @@ auto Ghost::NextCell(const Direction &direction) const -> Vec2 {
   }
 }
 
-auto Ghost::IsInTunnel() const -> bool {
-  auto currentCell = GetCell();
-
-  if (currentCell.y != kTunnelRow) {
-    return false;
-  }
+auto Ghost::IsInTunnel() const -> bool { return inTunnel(GetCell()); }
 
-  return currentCell.x < 4 || currentCell.x > 22;
+void Ghost::MoveTowards(MoveMask open, const Vec2 &cell, const Vec2 &target) {
+  heading_ = open == 0 ? reverseDirection(heading_) : SteerTowards(cell, target, open);
+  alignToLane();
 }
 
-void Ghost::MoveTowards(Grid &grid, const Vec2 &target) {
-  auto candidates_ = Candidates(grid);
-
-  if (candidates_.empty()) {
-    heading_ = reverseDirection(heading_);
-  } else {
-    auto closest = candidates_.at(0);
-    for (auto &candidate : candidates_) {
-      if (candidate.position.Distance(target) < closest.position.Distance(target)) {
-        closest = candidate;
-      }
-    }
-    heading_ = closest.heading;
-  }
-
+void Ghost::alignToLane() {
   if (heading_ == Direction::kEast || heading_ == Direction::kWest) {
-    position_.y = floor(((int)position_.y / kCellSize) * kCellSize + (kCellSize / 2));
+    position_.y = CellCenter(position_.y);
   }
   if (heading_ == Direction::kNorth || heading_ == Direction::kSouth) {
-    position_.x = floor(((int)position_.x / kCellSize) * kCellSize + (kCellSize / 2));
+    position_.x = CellCenter(position_.x);
   }
 }
 
 auto Ghost::InCellCenter() const -> bool {
-  float centerX = center(position_.x);
-  float centerY = center(position_.y);
+  auto centerX = CellCenter(position_.x);
+  auto centerY = CellCenter(position_.y);
 
   return (heading_ == Direction::kNorth && position_.y <= centerY) ||
          (heading_ == Direction::kSouth && position_.y >= centerY) ||
@@ -146,49 +183,32 @@ auto Ghost::InCellCenter() const -> bool {
          (heading_ == Direction::kWest && position_.x <= centerX);
 }
 
-
-auto Ghost::Candidates(Grid &grid) -> std::vector<Candidate> {
-
-  auto results = std::vector<Candidate>{};
-  for (auto option : options) {
-    if (reverseDirection(option.heading) == previousHeading_) {
-      continue;
-    }
-
-    auto pos = GetCell() + option.position;
-    if (grid.GetCell(pos) == Cell::kWall) {
-      continue;
-    }
-
-    results.push_back(Candidate{.position = pos, .heading = option.heading});
-  }
-
-  return results;
+auto Ghost::OpenMoves(const Grid &grid, const Vec2 &cell) const -> MoveMask {
+  return grid.GhostExits(cell) & static_cast<MoveMask>(~MoveBit(reverseDirection(previousHeading_)));
 }
 
 void Ghost::HandleTunnelWrap() {
-  if (position_.x < -16) {
-    position_.x = kGridWidth * kCellSize + 16;
-  } else if (position_.x > kGridWidth * kCellSize + 16) {
-    position_.x = -16;
+  if (position_.x < FromPixels(-16)) {
+    position_.x = FromPixels(kGridWidth * kCellSize + 16);
+  } else if (position_.x > FromPixels(kGridWidth * kCellSize + 16)) {
+    position_.x = FromPixels(-16);
   }
 }
 
 void Ghost::HandleWallCollision(Grid &grid) {
-  auto nextPos = NextCell(heading_);
-  if (grid.GetCell(nextPos) == Cell::kWall) {
+  if ((grid.GhostExits(GetCell()) & MoveBit(heading_)) == 0) {
     switch (heading_) {
     case Direction::kEast:
-      position_.x = boundUpper(position_.x);
+      position_.x = BoundUpper(position_.x);
       break;
     case Direction::kWest:
-      position_.x = boundLower(position_.x);
+      position_.x = BoundLower(position_.x);
       break;
     case Direction::kNorth:
-      position_.y = boundLower(position_.y);
+      position_.y = BoundLower(position_.y);
       break;
     case Direction::kSouth:
-      position_.y = boundUpper(position_.y);
+      position_.y = BoundUpper(position_.y);
       break;
     default:
       break;
@@ -196,43 +216,64 @@ void Ghost::HandleWallCollision(Grid &grid) {
   }
 }
 
-void Ghost::UpdateMovement(float deltaTime, Grid &grid, const Vec2 &target, float speedMultiplier) {
-  if (IsInTunnel()) {
-    position_ += velocity_ * deltaTime * speedMultiplier;
-    HandleTunnelWrap();
+void Ghost::UpdateMovement(const Strides &strides, Grid &grid, const Vec2 &target, Direction steering, Speed speed) {
+  // Turning only re-centres the ghost within its cell, so the cell is fixed until it moves below
+  const auto cell = GetCell();
+  if (passTunnel(cell, strides[speed])) {
     return;
   }
 
   if (InCellCenter()) {
-    auto candidates_ = Candidates(grid);
-    if (candidates_.size() == 1) {
-      heading_ = candidates_[0].heading;
+    auto open = OpenMoves(grid, cell);
+    if (std::has_single_bit(open)) {
+      heading_ = kMoveHeadings[static_cast<std::size_t>(std::countr_zero(open))];
+    } else if (steering != Direction::kNeutral && (open & MoveBit(steering)) != 0) {
+      heading_ = steering;
+      alignToLane();
     } else {
-      MoveTowards(grid, target);
+      MoveTowards(open, cell, target);
     }
-    SetFramesForHeading(heading_);
     SetVelocityForHeading(heading_);
   }
 
-  if (previousCell_ != GetCell()) {
-    previousHeading_ = heading_;
+  advance(cell, strides[speed], grid);
+}
+
+void Ghost::FollowHomeField(const Strides &strides, Grid &grid, Speed speed) {
+  const auto cell = GetCell();
+  if (passTunnel(cell, strides[speed])) {
+    return;
   }
-  previousCell_ = GetCell();
 
-  position_ += velocity_ * deltaTime * speedMultiplier;
-  HandleWallCollision(grid);
+  if (InCellCenter()) {
+    auto heading = grid.HeadingHome(cell, personality_);
+    if (heading != Direction::kNeutral) {
+      heading_ = heading;
+      alignToLane();
+    }
+    SetVelocityForHeading(heading_);
+  }
+
+  advance(cell, strides[speed], grid);
 }
 
-void Ghost::Render(SDL_Renderer *renderer) {
-  Vec2 renderPos{floor(position_.x - kCellSize), floor(position_.y - kCellSize)};
+auto Ghost::passTunnel(const Vec2 &cell, Coord stride) -> bool {
+  if (!inTunnel(cell)) {
+    return false;
+  }
+  position_ = Advance(position_, velocity_, stride);
+  HandleTunnelWrap();
+  return true;
+}
 
-  if (stateType_ == GhostStateType::kScared) {
-    scaredSprite_->Render(renderer, renderPos);
-  } else if (stateType_ == GhostStateType::kRespawning) {
-    respawnSprite_->Render(renderer, renderPos);
-  } else {
-    sprite_->Render(renderer, renderPos);
+void Ghost::advance(const Vec2 &cell, Coord stride, Grid &grid) {
+  if (previousCell_ != cell) {
+    previousHeading_ = heading_;
   }
+  previousCell_ = cell;
+
+  position_ = Advance(position_, velocity_, stride);
+  HandleWallCollision(grid);
 }
 
 void Ghost::Reset() {
@@ -241,41 +282,8 @@ void Ghost::Reset() {
   previousHeading_ = Direction::kNeutral;
   previousCell_ = {0, 0};
 
-  if (IsInPen()) {
-    stateType_ = GhostStateType::kPenned;
-  } else {
-    stateType_ = GhostStateType::kScatter;
-  }
-  state_ = createState(stateType_);
-  state_->Enter(*this, stateType_); // Reset, no previous
-}
-
-void Ghost::SetFramesForHeading(Direction heading) {
-  switch (heading) {
-  case Direction::kNorth:
-    sprite_->SetFrames({4, 5});
-    respawnSprite_->SetFrames({2});
-    break;
-
-  case Direction::kSouth:
-    sprite_->SetFrames({6, 7});
-    respawnSprite_->SetFrames({3});
-    break;
-
-  case Direction::kEast:
-    sprite_->SetFrames({0, 1});
-    respawnSprite_->SetFrames({0});
-    break;
-
-  case Direction::kWest:
-    sprite_->SetFrames({2, 3});
-    respawnSprite_->SetFrames({1});
-    break;
-
-  default:
-    sprite_->SetFrames({2, 3});
-    break;
-  }
+  auto initial = IsInPen() ? GhostStateType::kPenned : GhostStateType::kScatter;
+  enterState(initial, initial); // Reset, no previous
 }
 
 auto Ghost::SetVelocityForHeading(Direction heading) -> void {
@@ -307,324 +315,126 @@ auto Ghost::IsInPen() const -> bool {
   return pos.x >= 12 && pos.x <= 16 && pos.y >= 17 && pos.y <= 18;
 }
 
-auto Ghost::GetCell() const -> Vec2 {
-  auto t = position_ / kCellSize;
-  return {.x = floor(t.x), .y = floor(t.y)};
-}
+auto Ghost::GetCell() const -> Vec2 { return CellOf(position_); }
 
-auto Ghost::ExitPen(float deltaTime) -> void {
+auto Ghost::ExitPen(const Strides &strides) -> void {
   heading_ = Direction::kNorth;
 
-  SetFramesForHeading(heading_);
   SetVelocityForHeading(heading_);
 
-  position_ += (velocity_ / 2.0f * deltaTime);
+  position_ = Advance(position_, velocity_, strides[Speed::kGhostInPen]);
 }
 
-auto Ghost::PenDance(float deltaTime) -> void {
-  SetFramesForHeading(heading_);
+auto Ghost::PenDance(const Strides &strides) -> void {
   SetVelocityForHeading(heading_);
 
-  position_ += (velocity_ / 2.0f * deltaTime);
+  position_ = Advance(position_, velocity_, strides[Speed::kGhostInPen]);
 
-  if (position_.y < kPenTop) {
-    position_.y = kPenTop;
+  if (position_.y < FromPixels(kPenTop)) {
+    position_.y = FromPixels(kPenTop);
     heading_ = reverseDirection(heading_);
   }
 
-  if (position_.y > kPenBottom) {
-    position_.y = kPenBottom;
+  if (position_.y > FromPixels(kPenBottom)) {
+    position_.y = FromPixels(kPenBottom);
     heading_ = reverseDirection(heading_);
   }
 
-  SetFramesForHeading(heading_);
   SetVelocityForHeading(heading_);
 }
 
-// Blinky
-
-BlinkyConfig::BlinkyConfig(SDL_Renderer *renderer) : GhostConfig{renderer} {}
-
-auto BlinkyConfig::GetTargeter() const -> Targeter {
-  return [](Ghost &me, Pacman &pacman, [[maybe_unused]] Ghost &blinky, GhostMode mode) {
-    if (mode == GhostMode::kScatter || mode == GhostMode::kScared) {
-      return me.GetScatterCell();
-    }
-
-    return pacman.GetCell();
-  };
-}
-
-auto BlinkyConfig::GetScatterCell() const -> Vec2 { return kBlinkyScatterCell; }
-
-auto BlinkyConfig::GetSprite() const -> std::unique_ptr<Sprite> {
-  return std::make_unique<Sprite>(renderer, Sprites::kBlinky, kGhostFps, kGhostFrameWidth);
-}
-
-auto BlinkyConfig::GetInitialPosition() const -> Vec2 {
-  return Vec2{.x = kBlinkyStartCell.x * kCellSize, .y = kBlinkyStartCell.y * kCellSize + (kCellSize / 2)};
-}
-
-auto BlinkyConfig::GetInitialHeading() const -> Direction { return Direction::kWest; }
-
-// Inky
-
-InkyConfig::InkyConfig(SDL_Renderer *renderer) : GhostConfig{renderer} {}
-
-auto InkyConfig::GetTargeter() const -> Targeter {
-  return [](Ghost &me, Pacman &pacman, Ghost &blinky, GhostMode mode) {
-    if (mode == GhostMode::kScatter || mode == GhostMode::kScared) {
-      return me.GetScatterCell();
-    }
-    Vec2 target = pacman.GetCell();
-
-    if (pacman.GetHeading() == Direction::kNorth) {
-      target += Vec2{.x = 0, .y = -kInkyPacmanOffset};
-    } else if (pacman.GetHeading() == Direction::kSouth) {
-      target += Vec2{.x = 0, .y = kInkyPacmanOffset};
-    } else if (pacman.GetHeading() == Direction::kEast) {
-      target += Vec2{.x = kInkyPacmanOffset, .y = 0};
-    } else if (pacman.GetHeading() == Direction::kWest) {
-      target += Vec2{.x = -kInkyPacmanOffset, .y = 0};
-    }
-
-    auto projection = target - blinky.GetCell();
-    projection = projection * 2;
-
-    return blinky.GetCell() + projection;
-  };
-};
-
-auto InkyConfig::GetScatterCell() const -> Vec2 { return kInkyScatterCell; }
-
-auto InkyConfig::GetSprite() const -> std::unique_ptr<Sprite> {
-  return std::make_unique<Sprite>(renderer, Sprites::kInky, kGhostFps, kGhostFrameWidth);
-}
-
-auto InkyConfig::GetInitialPosition() const -> Vec2 {
-  return Vec2{.x = kInkyStartCell.x * kCellSize, .y = kInkyStartCell.y * kCellSize + (kCellSize / 2)};
-}
-
-auto InkyConfig::GetInitialHeading() const -> Direction { return Direction::kNorth; }
-
-// Pinky
-
-PinkyConfig::PinkyConfig(SDL_Renderer *renderer) : GhostConfig{renderer} {}
-
-auto PinkyConfig::GetTargeter() const -> Targeter {
-  return [](Ghost &me, Pacman &pacman, [[maybe_unused]] Ghost &blinky, GhostMode mode) {
-    if (mode == GhostMode::kScatter || mode == GhostMode::kScared) {
-      return me.GetScatterCell();
-    }
-
-    Vec2 target = pacman.GetCell();
-
-    if (pacman.GetHeading() == Direction::kNorth) {
-      target += Vec2{.x = 0, .y = -kPinkyTargetOffset};
-    } else if (pacman.GetHeading() == Direction::kSouth) {
-      target += Vec2{.x = 0, .y = kPinkyTargetOffset};
-    } else if (pacman.GetHeading() == Direction::kEast) {
-      target += Vec2{.x = kPinkyTargetOffset, .y = 0};
-    } else if (pacman.GetHeading() == Direction::kWest) {
-      target += Vec2{.x = -kPinkyTargetOffset, .y = 0};
-    }
-
-    return target;
-  };
-}
-
-auto PinkyConfig::GetScatterCell() const -> Vec2 { return kPinkyScatterCell; }
-
-auto PinkyConfig::GetSprite() const -> std::unique_ptr<Sprite> {
-  return std::make_unique<Sprite>(renderer, Sprites::kPinky, kGhostFps, kGhostFrameWidth);
-}
-
-auto PinkyConfig::GetInitialPosition() const -> Vec2 {
-  return Vec2{.x = kPinkyStartCell.x * kCellSize, .y = kPinkyStartCell.y * kCellSize + (kCellSize / 2)};
-}
-
-auto PinkyConfig::GetInitialHeading() const -> Direction { return Direction::kSouth; }
-
-// Clyde
-
-ClydeConfig::ClydeConfig(SDL_Renderer *renderer) : GhostConfig{renderer} {}
-
-auto ClydeConfig::GetTargeter() const -> Targeter {
-  return [](Ghost &me, Pacman &pacman, [[maybe_unused]] Ghost &blinky, GhostMode mode) {
-    if (mode == GhostMode::kScatter || mode == GhostMode::kScared) {
-      return me.GetScatterCell();
-    }
-
-    auto d = me.GetCell().Distance(pacman.GetCell());
-    if (d > kClydeRelaxDistance) {
-      return pacman.GetCell();
-    }
-
-    return me.GetScatterCell();
-  };
-}
-
-auto ClydeConfig::GetScatterCell() const -> Vec2 { return kClydeScatterCell; }
-
-auto ClydeConfig::GetSprite() const -> std::unique_ptr<Sprite> {
-  return std::make_unique<Sprite>(renderer, Sprites::kClyde, kGhostFps, kGhostFrameWidth);
-}
-
-auto ClydeConfig::GetInitialPosition() const -> Vec2 {
-  return Vec2{.x = kClydeStartCell.x * kCellSize, .y = kClydeStartCell.y * kCellSize + (kCellSize / 2)};
-}
-
-auto ClydeConfig::GetInitialHeading() const -> Direction { return Direction::kNorth; }
-
-GhostConfig::GhostConfig(SDL_Renderer *renderer) : renderer{renderer} {}
-
-auto GhostConfig::GetScaredSprite() const -> std::unique_ptr<Sprite> {
-  return std::make_unique<Sprite>(renderer, Sprites::kScaredGhost, kGhostFps, kGhostFrameWidth);
-}
-
-auto GhostConfig::GetRespawnSprite() const -> std::unique_ptr<Sprite> {
-  return std::make_unique<Sprite>(renderer, Sprites::kGhostEyes, kGhostFps, kGhostFrameWidth);
-}
-
 // State implementations
 
-class PennedState : public GhostState {
-public:
-  void Enter(Ghost &ghost, GhostStateType /*fromState*/) override {}
-
-  auto Update(Ghost &ghost, float deltaTime, const UpdateContext &ctx) -> GhostStateType override {
-    ghost.PenDance(deltaTime);
+template <GhostPersonality Personality>
+auto PennedState::Update(Ghost &ghost, const UpdateContext &ctx) -> GhostStateType {
+  ghost.PenDance(ctx.strides);
 
-    if (ghost.IsActive()) {
-      return GhostStateType::kExitingPen;
-    }
-    return GhostStateType::kPenned;
-  }
-};
-
-class ExitingPenState : public GhostState {
-public:
-  void Enter(Ghost &ghost, GhostStateType /*fromState*/) override {
-    ghost.SetHeading(Direction::kNorth);
-  }
-
-  auto Update(Ghost &ghost, float deltaTime, const UpdateContext &ctx) -> GhostStateType override {
-    ghost.ExitPen(deltaTime);
-
-    if (ghost.GetCell().y < kPenTop / kCellSize) {
-      return GhostStateType::kScatter;
-    }
+  if (ghost.IsActive()) {
     return GhostStateType::kExitingPen;
   }
-};
-
-class ChaseState : public GhostState {
-public:
-  void Enter(Ghost &ghost, GhostStateType fromState) override {
-    if (fromState == GhostStateType::kScatter) {
-      ghost.SetHeading(reverseDirection(ghost.GetHeading()));
-    }
-    ghost.SetFramesForHeading(ghost.GetHeading());
-    ghost.SetVelocityForHeading(ghost.GetHeading());
-  }
-
-  auto Update(Ghost &ghost, float deltaTime, const UpdateContext &ctx) -> GhostStateType override {
-    auto target = ghost.GetTargeter()(ghost, ctx.pacman, ctx.blinky, GhostMode::kChase);
-    ghost.UpdateMovement(deltaTime, ctx.grid, target);
+  return GhostStateType::kPenned;
+}
 
-    if (ctx.pacman.IsEnergized()) {
-      return GhostStateType::kScared;
-    }
+void ExitingPenState::Enter(Ghost &ghost, GhostStateType /*fromState*/) { ghost.SetHeading(Direction::kNorth); }
 
-    if (ctx.waveManager.GetCurrentMode() == GhostMode::kScatter) {
-      return GhostStateType::kScatter;
-    }
+template <GhostPersonality Personality>
+auto ExitingPenState::Update(Ghost &ghost, const UpdateContext &ctx) -> GhostStateType {
+  ghost.ExitPen(ctx.strides);
 
-    return GhostStateType::kChase;
+  if (ghost.GetCell().y < kPenTop / kCellSize) {
+    return GhostStateType::kScatter;
   }
-};
+  return GhostStateType::kExitingPen;
+}
 
-class ScatterState : public GhostState {
-public:
-  void Enter(Ghost &ghost, GhostStateType fromState) override {
-    // Only reverse direction when transitioning from Chase (not from ExitingPen)
-    if (fromState == GhostStateType::kChase) {
-      ghost.SetHeading(reverseDirection(ghost.GetHeading()));
-    }
-    ghost.SetFramesForHeading(ghost.GetHeading());
-    ghost.SetVelocityForHeading(ghost.GetHeading());
+void ChaseState::Enter(Ghost &ghost, GhostStateType fromState) {
+  if (fromState == GhostStateType::kScatter) {
+    ghost.SetHeading(reverseDirection(ghost.GetHeading()));
   }
+  ghost.SetVelocityForHeading(ghost.GetHeading());
+}
 
-  auto Update(Ghost &ghost, float deltaTime, const UpdateContext &ctx) -> GhostStateType override {
-    ghost.UpdateMovement(deltaTime, ctx.grid, ghost.GetScatterCell());
-
-    if (ctx.pacman.IsEnergized()) {
-      return GhostStateType::kScared;
-    }
+template <GhostPersonality Personality>
+auto ChaseState::Update(Ghost &ghost, const UpdateContext &ctx) -> GhostStateType {
+  ghost.UpdateMovement(ctx.strides, ctx.grid, Personality::ChaseTarget(ghost, ctx.pacman, ctx.blinky), ctx.steering);
 
-    if (ctx.waveManager.GetCurrentMode() == GhostMode::kChase) {
-      return GhostStateType::kChase;
-    }
+  if (ctx.pacman.IsEnergized()) {
+    return GhostStateType::kScared;
+  }
 
+  if (ctx.waveManager.GetCurrentMode() == GhostMode::kScatter) {
     return GhostStateType::kScatter;
   }
-};
 
-class ScaredState : public GhostState {
-public:
-  void Enter(Ghost &ghost, GhostStateType /*fromState*/) override {
+  return GhostStateType::kChase;
+}
+
+void ScatterState::Enter(Ghost &ghost, GhostStateType fromState) {
+  // Only reverse direction when transitioning from Chase (not from ExitingPen)
+  if (fromState == GhostStateType::kChase) {
     ghost.SetHeading(reverseDirection(ghost.GetHeading()));
-    ghost.SetFramesForHeading(ghost.GetHeading());
-    ghost.SetVelocityForHeading(ghost.GetHeading());
   }
+  ghost.SetVelocityForHeading(ghost.GetHeading());
+}
 
-  auto Update(Ghost &ghost, float deltaTime, const UpdateContext &ctx) -> GhostStateType override {
-    ghost.UpdateMovement(deltaTime, ctx.grid, ghost.GetScatterCell());
-
-    if (!ctx.pacman.IsEnergized()) {
-      return ctx.waveManager.GetCurrentMode() == GhostMode::kChase ? GhostStateType::kChase
-                                                                   : GhostStateType::kScatter;
-    }
+template <GhostPersonality Personality>
+auto ScatterState::Update(Ghost &ghost, const UpdateContext &ctx) -> GhostStateType {
+  ghost.UpdateMovement(ctx.strides, ctx.grid, Personality::kScatterCell, ctx.steering);
 
+  if (ctx.pacman.IsEnergized()) {
     return GhostStateType::kScared;
   }
-};
 
-class RespawningState : public GhostState {
-public:
-  void Enter(Ghost &ghost, GhostStateType /*fromState*/) override {
-    ghost.SetFramesForHeading(ghost.GetHeading());
+  if (ctx.waveManager.GetCurrentMode() == GhostMode::kChase) {
+    return GhostStateType::kChase;
   }
 
-  auto Update(Ghost &ghost, float deltaTime, const UpdateContext &ctx) -> GhostStateType override {
-    auto target = toCell(ghost.GetInitialPosition());
+  return GhostStateType::kScatter;
+}
 
-    ghost.UpdateMovement(deltaTime, ctx.grid, target, 2.0f);
+void ScaredState::Enter(Ghost &ghost, GhostStateType /*fromState*/) {
+  ghost.SetHeading(reverseDirection(ghost.GetHeading()));
+  ghost.SetVelocityForHeading(ghost.GetHeading());
+}
 
-    if (ghost.GetCell() == target) {
-      return GhostStateType::kExitingPen;
-    }
+template <GhostPersonality Personality>
+auto ScaredState::Update(Ghost &ghost, const UpdateContext &ctx) -> GhostStateType {
+  ghost.UpdateMovement(ctx.strides, ctx.grid, Personality::kScatterCell, ctx.steering);
 
-    return GhostStateType::kRespawning;
+  if (!ctx.pacman.IsEnergized()) {
+    return ctx.waveManager.GetCurrentMode() == GhostMode::kChase ? GhostStateType::kChase : GhostStateType::kScatter;
   }
-};
 
-// Factory function for creating ghost states
-auto Ghost::createState(GhostStateType type) -> std::unique_ptr<GhostState> {
-  switch (type) {
-  case GhostStateType::kPenned:
-    return std::make_unique<PennedState>();
-  case GhostStateType::kExitingPen:
-    return std::make_unique<ExitingPenState>();
-  case GhostStateType::kChase:
-    return std::make_unique<ChaseState>();
-  case GhostStateType::kScatter:
-    return std::make_unique<ScatterState>();
-  case GhostStateType::kScared:
-    return std::make_unique<ScaredState>();
-  case GhostStateType::kRespawning:
-    return std::make_unique<RespawningState>();
-  default:
-    return std::make_unique<PennedState>();
+  return GhostStateType::kScared;
+}
+
+template <GhostPersonality Personality>
+auto RespawningState::Update(Ghost &ghost, const UpdateContext &ctx) -> GhostStateType {
+  ghost.FollowHomeField(ctx.strides, ctx.grid, Speed::kGhostRespawning);
+
+  if (ghost.GetCell() == Personality::kStartCell) {
+    return GhostStateType::kExitingPen;
   }
+
+  return GhostStateType::kRespawning;
 }
@@ -1,25 +1,97 @@
 #ifndef GHOST_H
 #define GHOST_H
 
-#include <memory>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <variant>
 
 #include "constants.h"
 #include "game-context.h"
+#include "ghost-steering.h"
 #include "grid.h"
+#include "movement.h"
 #include "pacman.h"
-#include "sprite.h"
 #include "vector2.h"
 
-struct Candidate {
-  Vec2 position;
-  Direction heading;
-};
-
 class Ghost;
 class Pacman;
-class GhostState;
 
-using Targeter = Vec2 (*)(Ghost &me, Pacman &pacman, Ghost &blinky, GhostMode mode);
+/// Compile-time description of a ghost: where it starts, which corner it
+/// scatters to and how it picks its target while chasing. Ghost's update is
+/// instantiated once per personality, so ChaseTarget is inlined into it.
+template <typename Personality>
+concept GhostPersonality = requires(const Ghost &me, const Pacman &pacman, const Ghost &blinky) {
+  { Personality::kStartCell } -> std::convertible_to<Vec2>;
+  { Personality::kScatterCell } -> std::convertible_to<Vec2>;
+  { Personality::kInitialHeading } -> std::convertible_to<Direction>;
+  { Personality::ChaseTarget(me, pacman, blinky) } -> std::same_as<Vec2>;
+};
+
+/// Type list of personalities a Ghost can be constructed with.
+template <GhostPersonality... Personalities>
+struct PersonalityList {
+  static constexpr std::size_t kSize = sizeof...(Personalities);
+
+  /// Position of `Personality` in the list, or kSize if it is not listed.
+  template <typename Personality>
+  static constexpr auto IndexOf() -> std::size_t {
+    constexpr std::array<bool, kSize> matches{std::is_same_v<Personality, Personalities>...};
+    for (std::size_t i = 0; i < kSize; ++i) {
+      if (matches[i]) {
+        return i;
+      }
+    }
+    return kSize;
+  }
+
+  /// Calls `visitor.template operator()<Personality>()` for the personality at `index`.
+  template <typename Visitor>
+  static constexpr auto Visit(std::size_t index, Visitor &&visitor) -> void {
+    [&]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+      (void)((index == Indices && (visitor.template operator()<Personalities>(), true)) || ...);
+    }(std::index_sequence_for<Personalities...>{});
+  }
+};
+
+/// Targets Pacman's cell.
+struct BlinkyPersonality {
+  static constexpr Vec2 kStartCell = kBlinkyStartCell;
+  static constexpr Vec2 kScatterCell = kBlinkyScatterCell;
+  static constexpr Direction kInitialHeading = Direction::kWest;
+  static auto ChaseTarget(const Ghost &me, const Pacman &pacman, const Ghost &blinky) -> Vec2;
+};
+
+/// Doubles the vector from Blinky to a cell ahead of Pacman.
+struct InkyPersonality {
+  static constexpr Vec2 kStartCell = kInkyStartCell;
+  static constexpr Vec2 kScatterCell = kInkyScatterCell;
+  static constexpr Direction kInitialHeading = Direction::kNorth;
+  static auto ChaseTarget(const Ghost &me, const Pacman &pacman, const Ghost &blinky) -> Vec2;
+};
+
+/// Targets a few cells ahead of Pacman.
+struct PinkyPersonality {
+  static constexpr Vec2 kStartCell = kPinkyStartCell;
+  static constexpr Vec2 kScatterCell = kPinkyScatterCell;
+  static constexpr Direction kInitialHeading = Direction::kSouth;
+  static auto ChaseTarget(const Ghost &me, const Pacman &pacman, const Ghost &blinky) -> Vec2;
+};
+
+/// Targets Pacman from afar and its scatter corner up close.
+struct ClydePersonality {
+  static constexpr Vec2 kStartCell = kClydeStartCell;
+  static constexpr Vec2 kScatterCell = kClydeScatterCell;
+  static constexpr Direction kInitialHeading = Direction::kNorth;
+  static auto ChaseTarget(const Ghost &me, const Pacman &pacman, const Ghost &blinky) -> Vec2;
+};
+
+/// Every personality Ghost can be constructed with. Add a type satisfying
+/// GhostPersonality here to register a new one.
+using GhostPersonalities = PersonalityList<BlinkyPersonality, InkyPersonality, PinkyPersonality, ClydePersonality>;
 
 enum class GhostStateType {
   kPenned,
@@ -30,64 +102,135 @@ enum class GhostStateType {
   kRespawning,
 };
 
+/// Plain-data copy of a ghost's mutable state. Personality is fixed at
+/// construction and not included.
+struct GhostSnapshot {
+  Vec2 position;
+  Vec2 velocity;
+  Direction heading;
+  Direction previousHeading;
+  Vec2 previousCell;
+  GhostStateType stateType;
+  GhostStateType previousActiveState;
+  bool active;
+
+  auto operator==(const GhostSnapshot &) const -> bool = default;
+};
+
 struct UpdateContext {
   Grid &grid;
   GameContext &context;
   Pacman &pacman;
   Ghost &blinky;
   GhostWaveManager &waveManager;
+  Direction steering; ///< Heading chosen by a batched SteerTowards, or kNeutral
+  Strides strides;    ///< How far each Speed moves this update
+};
+
+// Ghost states. Each is an empty type with an Enter hook and an Update that
+// returns the state to be in next; Ghost holds the current one in a variant, so
+// dispatch is static and changing state never allocates. Update is a template
+// over the ghost's personality and is instantiated for each registered one.
+
+struct PennedState {
+  static constexpr auto kType = GhostStateType::kPenned;
+  void Enter(Ghost & /*ghost*/, GhostStateType /*fromState*/) {}
+  template <GhostPersonality Personality>
+  auto Update(Ghost &ghost, const UpdateContext &ctx) -> GhostStateType;
 };
 
-struct GhostConfig {
-  GhostConfig(SDL_Renderer *renderer);
+struct ExitingPenState {
+  static constexpr auto kType = GhostStateType::kExitingPen;
+  void Enter(Ghost &ghost, GhostStateType fromState);
+  template <GhostPersonality Personality>
+  auto Update(Ghost &ghost, const UpdateContext &ctx) -> GhostStateType;
+};
 
-  std::unique_ptr<Sprite> GetScaredSprite() const;
-  auto GetRespawnSprite() const -> std::unique_ptr<Sprite>;
+struct ChaseState {
+  static constexpr auto kType = GhostStateType::kChase;
+  void Enter(Ghost &ghost, GhostStateType fromState);
+  template <GhostPersonality Personality>
+  auto Update(Ghost &ghost, const UpdateContext &ctx) -> GhostStateType;
+};
 
-  virtual std::unique_ptr<Sprite> GetSprite() const = 0;
-  virtual Vec2 GetInitialPosition() const = 0;
-  virtual Direction GetInitialHeading() const = 0;
-  virtual Targeter GetTargeter() const = 0;
-  virtual Vec2 GetScatterCell() const = 0;
+struct ScatterState {
+  static constexpr auto kType = GhostStateType::kScatter;
+  void Enter(Ghost &ghost, GhostStateType fromState);
+  template <GhostPersonality Personality>
+  auto Update(Ghost &ghost, const UpdateContext &ctx) -> GhostStateType;
+};
 
-protected:
-  SDL_Renderer *renderer;
+struct ScaredState {
+  static constexpr auto kType = GhostStateType::kScared;
+  void Enter(Ghost &ghost, GhostStateType fromState);
+  template <GhostPersonality Personality>
+  auto Update(Ghost &ghost, const UpdateContext &ctx) -> GhostStateType;
 };
 
+struct RespawningState {
+  static constexpr auto kType = GhostStateType::kRespawning;
+  void Enter(Ghost & /*ghost*/, GhostStateType /*fromState*/) {}
+  template <GhostPersonality Personality>
+  auto Update(Ghost &ghost, const UpdateContext &ctx) -> GhostStateType;
+};
+
+/// Alternatives are in GhostStateType order, so index() is the state type.
+using GhostState = std::variant<PennedState, ExitingPenState, ChaseState, ScatterState, ScaredState, RespawningState>;
+
 class Ghost {
 public:
-  Ghost(const GhostConfig &config);
+  template <GhostPersonality Personality>
+  explicit Ghost(Personality /*personality*/)
+      : Ghost{GhostPersonalities::IndexOf<Personality>(), Personality::kStartCell, Personality::kScatterCell,
+              Personality::kInitialHeading} {
+    static_assert(GhostPersonalities::IndexOf<Personality>() < GhostPersonalities::kSize,
+                  "personality must be registered in GhostPersonalities");
+    static_assert(kGhostStartCells[GhostPersonalities::IndexOf<Personality>()].x == Personality::kStartCell.x &&
+                      kGhostStartCells[GhostPersonalities::IndexOf<Personality>()].y == Personality::kStartCell.y,
+                  "kGhostStartCells must list start cells in GhostPersonalities order");
+  }
 
+  /// @param steering Heading for the intersection this update reaches, as chosen by
+  ///        SteerTowards(batch, ...) from PlanSteering; kNeutral to choose it here
   void Update(float deltaTime, Grid &grid, GameContext &context, Pacman &pacman, Ghost &blinky,
-              GhostWaveManager &waveManager);
-  void Render(SDL_Renderer *renderer);
+              GhostWaveManager &waveManager, Direction steering = Direction::kNeutral);
+
+  /// Returns the intersection choice this ghost faces on its next update, for a
+  /// steering batch lane: its cell, its target and the open moves. Ghosts with no
+  /// choice (between cell centres, in a corridor or the tunnel, or in a state that
+  /// does not chase a target) get no open moves.
+  auto PlanSteering(const Grid &grid, const Pacman &pacman, const Ghost &blinky) const -> SteeringInput;
   void Reset();
   Vec2 GetCell() const;
   Vec2 GetScatterCell() const { return scatterCell_; }
   void Activate() { active_ = true; }
-  auto GetStateType() const -> GhostStateType { return stateType_; }
-  auto IsScared() const -> bool { return stateType_ == GhostStateType::kScared; }
-  auto IsRespawning() const -> bool { return stateType_ == GhostStateType::kRespawning; }
+  auto GetStateType() const -> GhostStateType { return static_cast<GhostStateType>(state_.index()); }
+  auto IsScared() const -> bool { return GetStateType() == GhostStateType::kScared; }
+  auto IsRespawning() const -> bool { return GetStateType() == GhostStateType::kRespawning; }
   auto CanKill() const -> bool {
-    return stateType_ == GhostStateType::kChase || stateType_ == GhostStateType::kScatter;
+    return GetStateType() == GhostStateType::kChase || GetStateType() == GhostStateType::kScatter;
   }
   auto Pause() -> void;
   auto Resume() -> void;
 
+  auto Snapshot() const -> GhostSnapshot;
+  void Restore(const GhostSnapshot &snapshot);
+
   // State machine
   void TransitionTo(GhostStateType newState);
   auto GetPreviousActiveState() const -> GhostStateType { return previousActiveState_; }
 
   // Accessors for states
-  auto GetPosition() const -> Vec2 { return position_; }
+  auto GetPosition() const -> Vec2 { return ToVec2(position_); }
   auto GetHeading() const -> Direction { return heading_; }
   auto GetVelocity() const -> Vec2 { return velocity_; }
-  auto GetInitialPosition() const -> Vec2 { return initialPosition_; }
-  auto GetTargeter() const -> Targeter { return targeter_; }
+  auto GetInitialPosition() const -> Vec2 { return ToVec2(initialPosition_); }
+  /// Index of this ghost's personality in GhostPersonalities.
+  auto GetPersonality() const -> std::size_t { return personality_; }
   auto IsActive() const -> bool { return active_; }
 
   // Mutators for states
-  void SetPosition(Vec2 pos) { position_ = pos; }
+  void SetPosition(Vec2 pos) { position_ = ToPosition(pos); }
   void SetHeading(Direction dir) { heading_ = dir; }
   void SetVelocity(Vec2 vel) { velocity_ = vel; }
   void SetPreviousHeading(Direction dir) { previousHeading_ = dir; }
@@ -96,106 +239,105 @@ public:
   auto GetPreviousCell() const -> Vec2 { return previousCell_; }
 
   // Movement helpers for states
-  void SetFramesForHeading(Direction heading);
   void SetVelocityForHeading(Direction heading);
-  void ExitPen(float deltaTime);
-  void PenDance(float deltaTime);
-  void MoveTowards(Grid &grid, const Vec2 &target);
+  void ExitPen(const Strides &strides);
+  void PenDance(const Strides &strides);
+  void MoveTowards(MoveMask open, const Vec2 &cell, const Vec2 &target);
   void HandleTunnelWrap();
   void HandleWallCollision(Grid &grid);
-  void UpdateMovement(float deltaTime, Grid &grid, const Vec2 &target, float speedMultiplier = 1.0f);
+  /// Moves toward `target`, turning at cell centres. `steering`, when not kNeutral,
+  /// is the heading already chosen for an intersection (see PlanSteering).
+  void UpdateMovement(const Strides &strides, Grid &grid, const Vec2 &target, Direction steering = Direction::kNeutral,
+                      Speed speed = Speed::kGhost);
+  /// Moves along Grid::HeadingHome toward this ghost's start cell, turning (and
+  /// reversing if need be) only at cell centres.
+  void FollowHomeField(const Strides &strides, Grid &grid, Speed speed = Speed::kGhost);
   auto InCellCenter() const -> bool;
   auto IsInPen() const -> bool;
   auto IsInTunnel() const -> bool;
   auto NextCell(const Direction &direction) const -> Vec2;
-  auto Candidates(Grid &grid) -> std::vector<Candidate>;
+  /// Returns the moves out of `cell` that are not walls or a reversal.
+  auto OpenMoves(const Grid &grid, const Vec2 &cell) const -> MoveMask;
 
 private:
-  auto createState(GhostStateType type) -> std::unique_ptr<GhostState>;
+  Ghost(std::size_t personality, Vec2 startCell, Vec2 scatterCell, Direction heading);
 
+  template <GhostPersonality Personality>
+  void update(const UpdateContext &ctx);
+  void enterState(GhostStateType type, GhostStateType fromState);
+  void alignToLane();
+  auto passTunnel(const Vec2 &cell, Coord stride) -> bool;
+  void advance(const Vec2 &cell, Coord stride, Grid &grid);
+
+  std::uint8_t personality_;
   bool active_{false};
-  Vec2 position_{};
-  Vec2 initialPosition_;
+  Position position_{};
+  Position initialPosition_;
   Vec2 velocity_{};
   Direction heading_;
-  Targeter targeter_;
 
   Direction previousHeading_{Direction::kNeutral};
   Vec2 previousCell_{0, 0};
   Vec2 scatterCell_{0, 0};
 
   // State machine
-  std::unique_ptr<GhostState> state_;
-  GhostStateType stateType_{GhostStateType::kPenned};
+  GhostState state_{};
   GhostStateType previousActiveState_{GhostStateType::kScatter};
-
-  std::unique_ptr<Sprite> sprite_;
-  std::unique_ptr<Sprite> scaredSprite_;
-  std::unique_ptr<Sprite> respawnSprite_;
 };
 
-struct BlinkyConfig : public GhostConfig {
-  BlinkyConfig(SDL_Renderer *renderer);
-
-  std::unique_ptr<Sprite> GetSprite() const override;
-  Vec2 GetInitialPosition() const override;
-  Direction GetInitialHeading() const override;
-  Targeter GetTargeter() const override;
-  Vec2 GetScatterCell() const override;
-};
+static_assert(std::is_trivially_copyable_v<Ghost>, "ghosts must be copyable as raw bytes");
 
-struct InkyConfig : public GhostConfig {
-  InkyConfig(SDL_Renderer *renderer);
+// Personality targeting is defined here, after Ghost, so every translation unit
+// that instantiates a ghost update can inline it.
 
-  std::unique_ptr<Sprite> GetSprite() const override;
-  Vec2 GetInitialPosition() const override;
-  Direction GetInitialHeading() const override;
-  Targeter GetTargeter() const override;
-  Vec2 GetScatterCell() const override;
-};
+inline auto BlinkyPersonality::ChaseTarget(const Ghost & /*me*/, const Pacman &pacman, const Ghost & /*blinky*/)
+    -> Vec2 {
+  return pacman.GetCell();
+}
 
-struct PinkyConfig : public GhostConfig {
-  PinkyConfig(SDL_Renderer *renderer);
+inline auto InkyPersonality::ChaseTarget(const Ghost & /*me*/, const Pacman &pacman, const Ghost &blinky) -> Vec2 {
+  Vec2 target = pacman.GetCell();
 
-  std::unique_ptr<Sprite> GetSprite() const override;
-  Vec2 GetInitialPosition() const override;
-  Direction GetInitialHeading() const override;
-  Targeter GetTargeter() const override;
-  Vec2 GetScatterCell() const override;
-};
+  if (pacman.GetHeading() == Direction::kNorth) {
+    target += Vec2{.x = 0, .y = -kInkyPacmanOffset};
+  } else if (pacman.GetHeading() == Direction::kSouth) {
+    target += Vec2{.x = 0, .y = kInkyPacmanOffset};
+  } else if (pacman.GetHeading() == Direction::kEast) {
+    target += Vec2{.x = kInkyPacmanOffset, .y = 0};
+  } else if (pacman.GetHeading() == Direction::kWest) {
+    target += Vec2{.x = -kInkyPacmanOffset, .y = 0};
+  }
 
-struct ClydeConfig : public GhostConfig {
-  ClydeConfig(SDL_Renderer *renderer);
+  auto projection = target - blinky.GetCell();
+  projection = projection * 2;
 
-  std::unique_ptr<Sprite> GetSprite() const override;
-  Vec2 GetInitialPosition() const override;
-  Direction GetInitialHeading() const override;
-  Targeter GetTargeter() const override;
-  Vec2 GetScatterCell() const override;
-};
+  return blinky.GetCell() + projection;
+}
 
-struct Blinky : public Ghost {
-  Blinky(SDL_Renderer *renderer) : Ghost{BlinkyConfig{renderer}} {};
-};
+inline auto PinkyPersonality::ChaseTarget(const Ghost & /*me*/, const Pacman &pacman, const Ghost & /*blinky*/)
+    -> Vec2 {
+  Vec2 target = pacman.GetCell();
 
-struct Inky : public Ghost {
-  Inky(SDL_Renderer *renderer) : Ghost{InkyConfig{renderer}} {};
-};
+  if (pacman.GetHeading() == Direction::kNorth) {
+    target += Vec2{.x = 0, .y = -kPinkyTargetOffset};
+  } else if (pacman.GetHeading() == Direction::kSouth) {
+    target += Vec2{.x = 0, .y = kPinkyTargetOffset};
+  } else if (pacman.GetHeading() == Direction::kEast) {
+    target += Vec2{.x = kPinkyTargetOffset, .y = 0};
+  } else if (pacman.GetHeading() == Direction::kWest) {
+    target += Vec2{.x = -kPinkyTargetOffset, .y = 0};
+  }
 
-struct Pinky : public Ghost {
-  Pinky(SDL_Renderer *renderer) : Ghost{PinkyConfig{renderer}} {};
-};
+  return target;
+}
 
-struct Clyde : public Ghost {
-  Clyde(SDL_Renderer *renderer) : Ghost{ClydeConfig{renderer}} {};
-};
+inline auto ClydePersonality::ChaseTarget(const Ghost &me, const Pacman &pacman, const Ghost & /*blinky*/) -> Vec2 {
+  auto d = me.GetCell().Distance(pacman.GetCell());
+  if (d > kClydeRelaxDistance) {
+    return pacman.GetCell();
+  }
 
-// Base class for ghost states
-class GhostState {
-public:
-  virtual ~GhostState() = default;
-  virtual void Enter(Ghost &ghost, GhostStateType fromState) = 0;
-  virtual auto Update(Ghost &ghost, float deltaTime, const UpdateContext &ctx) -> GhostStateType = 0;
-};
+  return kScatterCell;
+}
 
-#endif
\ No newline at end of file
+#endif
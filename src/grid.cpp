@@ -1,62 +1,185 @@
 #include <algorithm>
 #include <fstream>
-#include <iostream>
+#include <stdexcept>
 
 #include "grid.h"
 
-auto Grid::HasPellet(const Vec2 &position) const -> bool {
-  return GetCell(position) == Cell::kPellet || GetCell(position) == Cell::kPowerPellet;
+namespace {
+
+auto flatten(const std::vector<std::vector<Cell>> &cells) -> std::array<Cell, kGridCells> {
+  if (cells.size() != kGridHeight) {
+    throw std::invalid_argument("grid must have " + std::to_string(kGridHeight) + " rows");
+  }
+
+  std::array<Cell, kGridCells> flat{};
+  for (int y = 0; y < kGridHeight; ++y) {
+    if (cells[y].size() != kGridWidth) {
+      throw std::invalid_argument("grid rows must have " + std::to_string(kGridWidth) + " columns");
+    }
+    std::copy(cells[y].begin(), cells[y].end(), flat.begin() + Grid::Index(0, y));
+  }
+  return flat;
 }
 
-auto Grid::Reset(SDL_Renderer *renderer) -> void {
-  cells = Grid::Load("../assets/maze.txt");
-  CreatePellets(renderer);
+// The heading that undoes each of kMoveHeadings
+constexpr std::array<Direction, 4> kStepBack{Direction::kSouth, Direction::kNorth, Direction::kWest, Direction::kEast};
+
+// Returns the neighbour of (x, y) toward kMoveHeadings[move], wrapping on the
+// tunnel row, or -1 off the board
+auto neighbour(int x, int y, std::size_t move) -> int {
+  auto nextX = x + kMoveOffsetX[move];
+  auto nextY = y + kMoveOffsetY[move];
+  if (nextY == kTunnelRow) {
+    nextX = (nextX + kGridWidth) % kGridWidth;
+  }
+  return Grid::InBounds(nextX, nextY) ? Grid::Index(nextX, nextY) : -1;
 }
 
-auto Grid::ConsumePellet(const Vec2 &position) -> std::unique_ptr<Pellet> {
-  auto it = pellets.find(position);
-  if (it != pellets.end()) {
-    auto tmp = std::move(it->second);
-    pellets.erase(it);
+auto buildExits(const CellBoard &walls, const CellBoard &gate, MazeNavigation &navigation) -> void {
+  for (int index = 0; index < kGridCells; ++index) {
+    MoveMask exits = 0;
+    MoveMask ghostExits = 0;
+    for (std::size_t move = 0; move < kMoveHeadings.size(); ++move) {
+      auto next = neighbour(index % kGridWidth, index / kGridWidth, move);
+      if (next < 0 || walls.test(next)) {
+        continue;
+      }
+      ghostExits |= static_cast<MoveMask>(1u << move);
+      if (!gate.test(next)) {
+        exits |= static_cast<MoveMask>(1u << move);
+      }
+    }
+    navigation.exits[index] = exits;
+    navigation.ghostExits[index] = ghostExits;
+  }
+}
 
-    cells.at(position.y).at(position.x) = Cell::kBlank;
+auto buildHomeField(const CellBoard &walls, std::size_t ghost, MazeNavigation &navigation) -> void {
+  auto &headings = navigation.homeHeadings[ghost];
+  headings.fill(static_cast<std::uint8_t>(Direction::kNeutral));
 
-    return tmp;
+  const auto &home = kGhostStartCells[ghost];
+  auto start = Grid::Index(static_cast<int>(home.x), static_cast<int>(home.y));
+  if (walls.test(start)) {
+    return;
   }
 
-  return {};
-}
+  // Breadth-first out from the start cell over ghost moves, so the field runs
+  // through the gate and covers the descent into the pen
+  std::array<int, kGridCells> queue{};
+  std::size_t head = 0;
+  std::size_t tail = 0;
+  CellBoard seen;
+  seen.set(start);
+  queue[tail++] = start;
+
+  while (head < tail) {
+    auto index = queue[head++];
+    for (std::size_t step = 0; step < kMoveHeadings.size(); ++step) {
+      if ((navigation.ghostExits[index] & (1u << step)) == 0) {
+        continue;
+      }
 
-auto Grid::CreatePellets(SDL_Renderer *renderer) -> void {
-  for (int y = 0; y < Height(); ++y) {
-    for (int x = 0; x < Width(); ++x) {
-      Vec2 position{static_cast<float>(x), (float)y};
-      if (GetCell(position) == Cell::kPowerPellet) {
-        pellets[position] = std::make_unique<Pellet>(renderer, position, true);
-      } else if (GetCell(position) == Cell::kPellet) {
-        pellets[position] = std::make_unique<Pellet>(renderer, position);
+      auto next = neighbour(index % kGridWidth, index / kGridWidth, step);
+      if (seen.test(next)) {
+        continue;
       }
+      seen.set(next);
+      headings[next] = static_cast<std::uint8_t>(kStepBack[step]);
+      queue[tail++] = next;
+    }
+  }
+}
+
+auto buildNavigation(const CellBoard &walls, const CellBoard &gate) -> std::shared_ptr<const MazeNavigation> {
+  auto navigation = std::make_shared<MazeNavigation>();
+  buildExits(walls, gate, *navigation);
+  for (std::size_t ghost = 0; ghost < kGhostCount; ++ghost) {
+    buildHomeField(walls, ghost, *navigation);
+  }
+  return navigation;
+}
+
+} // namespace
+
+Grid::Grid() {
+  // Every empty board has the same (all closed) tables
+  static const auto kEmpty = std::make_shared<const MazeNavigation>();
+  navigation_ = kEmpty;
+}
+
+Grid::Grid(const std::vector<std::vector<Cell>> &cells) : Grid{std::span<const Cell, kGridCells>{flatten(cells)}} {}
+
+Grid::Grid(std::span<const Cell, kGridCells> cells) {
+  std::copy(cells.begin(), cells.end(), cells_.begin());
+
+  for (int index = 0; index < kGridCells; ++index) {
+    switch (cells_[index]) {
+    case Cell::kWall:
+      walls_.set(index);
+      break;
+    case Cell::kGate:
+      gate_.set(index);
+      break;
+    case Cell::kPellet:
+      initialPellets_.set(index);
+      break;
+    case Cell::kPowerPellet:
+      initialPowerPellets_.set(index);
+      break;
+    default:
+      break;
     }
   }
+
+  navigation_ = buildNavigation(walls_, gate_);
+  Reset();
 }
 
-auto Grid::Update(const float deltaTime) -> void {
-  for (auto &pellet : pellets) {
-    pellet.second->Update(deltaTime);
+auto Grid::Reset() -> void { RestorePellets(initialPellets_ | initialPowerPellets_); }
+
+auto Grid::RestorePellets(const PelletBoard &board) -> void {
+  // Bits outside the maze's pellet cells (e.g. from another level's snapshot) are
+  // ignored, so walls, the gate and blank cells are never rewritten
+  auto masked = board & (initialPellets_ | initialPowerPellets_);
+
+  // Only cells whose occupancy differs need rewriting
+  auto changed = Pellets() ^ masked;
+  auto remaining = changed.count();
+  for (std::size_t i = 0; remaining > 0; ++i) {
+    if (!changed.test(i)) {
+      continue;
+    }
+    remaining--;
+
+    if (!masked.test(i)) {
+      cells_[i] = Cell::kBlank;
+    } else {
+      cells_[i] = initialPowerPellets_.test(i) ? Cell::kPowerPellet : Cell::kPellet;
+    }
   }
+
+  pellets_ = masked & initialPellets_;
+  powerPellets_ = masked & initialPowerPellets_;
 }
 
-auto Grid::Render(SDL_Renderer *renderer) -> void {
-  for (auto &pellet : pellets) {
-    pellet.second->Render(renderer);
+auto Grid::ConsumePellet(const Vec2 &position) -> Cell {
+  auto cell = GetCell(position);
+  if (cell != Cell::kPellet && cell != Cell::kPowerPellet) {
+    return Cell::kBlank;
   }
+
+  auto index = Index(static_cast<int>(position.x), static_cast<int>(position.y));
+  cells_[index] = Cell::kBlank;
+  pellets_.reset(index);
+  powerPellets_.reset(index);
+  return cell;
 }
 
 auto Grid::Load(const std::string &gridPath) -> std::vector<std::vector<Cell>> {
   std::fstream file{gridPath};
   if (!file.is_open()) {
-    std::cerr << "Unable to open grid at: " << gridPath << std::endl;
-    std::abort();
+    throw std::runtime_error("Unable to open grid at: " + gridPath);
   }
 
   std::vector<std::vector<Cell>> cells;
@@ -68,33 +191,12 @@ auto Grid::Load(const std::string &gridPath) -> std::vector<std::vector<Cell>> {
     row.reserve(line.size());
 
     for (auto &ch : line) {
-      switch (ch) {
-      case '#':
-        row.push_back(Cell::kWall);
-        break;
-
-      case '-':
-        row.push_back(Cell::kGate);
-        break;
-
-      case '.':
-        row.push_back(Cell::kPellet);
-        break;
-
-      case '*':
-        row.push_back(Cell::kPowerPellet);
-        break;
-
-      default:
-        row.push_back(Cell::kBlank);
-        break;
-      }
+      row.push_back(CellFromSymbol(ch));
     }
 
     if (row.size() != kGridWidth) {
-      std::cerr << "row " << y << " should have " << kGridWidth << " columns. found " << row.size() << "." << std::endl;
-      std::cerr << line << std::endl;
-      std::abort();
+      throw std::invalid_argument(gridPath + ": row " + std::to_string(y) + " should have " +
+                                  std::to_string(kGridWidth) + " columns. found " + std::to_string(row.size()));
     }
 
     cells.push_back(row);
@@ -102,8 +204,8 @@ auto Grid::Load(const std::string &gridPath) -> std::vector<std::vector<Cell>> {
   }
 
   if (cells.size() != kGridHeight) {
-    std::cerr << "expected grid of " << kGridHeight << " rows. got " << cells.size() << std::endl;
-    std::abort();
+    throw std::invalid_argument(gridPath + ": expected grid of " + std::to_string(kGridHeight) + " rows. got " +
+                                std::to_string(cells.size()));
   }
 
   file.close();
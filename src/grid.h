@@ -1,57 +1,219 @@
 #ifndef GRID_H
 #define GRID_H
 
-#include <fstream>
-#include <math.h>
+#include <array>
+#include <bitset>
+#include <cstdint>
 #include <memory>
+#include <span>
 #include <string>
-#include <unordered_map>
 #include <vector>
 
-#include "SDL.h"
-
-#include "pellet.h"
+#include "constants.h"
 #include "vector2.h"
 
-enum class Cell { kBlank, kWall, kGate, kPellet, kPowerPellet, kOffGrid };
+enum class Cell : unsigned char { kBlank, kWall, kGate, kPellet, kPowerPellet, kOffGrid };
 
 const int kGridWidth = 28;
 const int kGridHeight = 36;
+const int kGridCells = kGridWidth * kGridHeight;
+
+/// Returns the cell a maze text symbol stands for: '#' wall, '-' gate, '.' pellet,
+/// '*' power pellet, anything else blank.
+constexpr auto CellFromSymbol(char symbol) -> Cell {
+  switch (symbol) {
+  case '#':
+    return Cell::kWall;
+  case '-':
+    return Cell::kGate;
+  case '.':
+    return Cell::kPellet;
+  case '*':
+    return Cell::kPowerPellet;
+  default:
+    return Cell::kBlank;
+  }
+}
+
+/// One bit per cell of the maze in row-major order (bit `y * kGridWidth + x`).
+using CellBoard = std::bitset<kGridCells>;
+
+/// Remaining pellets (regular and power) of one maze, one bit per cell in row-major order.
+using PelletBoard = CellBoard;
+
+/// One bit per move out of a cell: bit i is set when kMoveHeadings[i] is open.
+using MoveMask = std::uint8_t;
+
+/// Moves in MoveMask bit order, which is also the order ghosts prefer when two
+/// moves are equally good.
+inline constexpr std::array<Direction, 4> kMoveHeadings{Direction::kNorth, Direction::kSouth, Direction::kEast,
+                                                        Direction::kWest};
+
+/// Cell offsets of kMoveHeadings.
+inline constexpr std::array<int, 4> kMoveOffsetX{0, 0, 1, -1};
+inline constexpr std::array<int, 4> kMoveOffsetY{-1, 1, 0, 0};
+
+/// Every move open.
+inline constexpr MoveMask kAllMoves = 0b1111;
+
+/// Returns the MoveMask bit of `heading`, or 0 for kNeutral.
+constexpr auto MoveBit(Direction heading) -> MoveMask {
+  for (std::size_t i = 0; i < kMoveHeadings.size(); ++i) {
+    if (kMoveHeadings[i] == heading) {
+      return static_cast<MoveMask>(1u << i);
+    }
+  }
+  return 0;
+}
+
+/// Read-only navigation tables of one maze layout: the legal moves out of every
+/// cell and a flow field toward each ghost's start cell. They never change while
+/// the maze is played, so Grid builds them once and every copy of that Grid (one
+/// per game in a batch) shares them.
+struct MazeNavigation {
+  std::array<MoveMask, kGridCells> exits{};
+  std::array<MoveMask, kGridCells> ghostExits{};
+  /// Direction per ghost and cell, see Grid::HeadingHome
+  std::array<std::array<std::uint8_t, kGridCells>, kGhostCount> homeHeadings{};
+};
 
+/// The 28x36 maze. Cells are stored flat, and walls, the pen gate, pellets and
+/// power pellets are also kept as bitboards so set queries (counting pellets,
+/// checking whether any are left) are popcounts instead of scans. The legal
+/// moves out of every cell and a flow field toward each ghost's start cell are
+/// built with the maze, so movement checks are single table reads. Copies of a
+/// Grid share those tables (see MazeNavigation) and own only the cells and
+/// bitboards.
 class Grid {
 public:
-  Grid() {};
-  Grid(std::vector<std::vector<Cell>> cells) : cells{cells} {};
+  /// An empty board with no exits.
+  Grid();
+
+  /// Builds the maze from rows as returned by Load. Throws std::invalid_argument
+  /// unless there are kGridHeight rows of kGridWidth cells.
+  explicit Grid(const std::vector<std::vector<Cell>> &cells);
+
+  /// Builds the maze from cells in row-major order, e.g. a level mapped from a LevelPack.
+  explicit Grid(std::span<const Cell, kGridCells> cells);
 
-  auto Update(const float deltaTime) -> void;
-  auto Render(SDL_Renderer *renderer) -> void;
+  static constexpr auto Width() -> int { return kGridWidth; }
+  static constexpr auto Height() -> int { return kGridHeight; }
 
-  auto Width() const -> int { return cells.at(0).size(); };
+  /// Returns true if (x, y) lies on the board.
+  static constexpr auto InBounds(int x, int y) -> bool { return x >= 0 && y >= 0 && x < kGridWidth && y < kGridHeight; }
 
-  auto Height() const -> int { return cells.size(); };
+  /// Returns the bit index of (x, y), which must be in bounds.
+  static constexpr auto Index(int x, int y) -> int { return y * kGridWidth + x; }
 
+  /// Returns the cell at integer coordinates, or kOffGrid outside the board.
+  auto GetCell(int x, int y) const -> Cell { return InBounds(x, y) ? cells_[Index(x, y)] : Cell::kOffGrid; }
+
+  /// Returns the cell containing `position`, given in cell units.
   auto GetCell(const Vec2 &position) const -> Cell {
     if (position.x < 0 || position.y < 0) {
       return Cell::kOffGrid;
     }
-    if (floor(position.x) >= kGridWidth) {
-      return Cell::kOffGrid;
-    }
-    return cells.at(floor(position.y)).at(floor(position.x));
-  };
+    return GetCell(static_cast<int>(position.x), static_cast<int>(position.y));
+  }
+
+  auto IsWall(int x, int y) const -> bool { return InBounds(x, y) && walls_.test(Index(x, y)); }
+  auto IsWall(const Vec2 &position) const -> bool { return GetCell(position) == Cell::kWall; }
+
+  auto HasPellet(int x, int y) const -> bool {
+    return InBounds(x, y) && (pellets_.test(Index(x, y)) || powerPellets_.test(Index(x, y)));
+  }
+  auto HasPellet(const Vec2 &position) const -> bool {
+    return position.x >= 0 && position.y >= 0 && HasPellet(static_cast<int>(position.x), static_cast<int>(position.y));
+  }
 
-  auto HasPellet(const Vec2 &position) const -> bool;
-  auto ConsumePellet(const Vec2 &position) -> std::unique_ptr<Pellet>;
+  /// Removes the pellet at `position` and returns the cell it occupied (kBlank if there was none).
+  auto ConsumePellet(const Vec2 &position) -> Cell;
 
-  auto Reset(SDL_Renderer *renderer) -> void;
+  /// Restores every pellet the grid was created with.
+  auto Reset() -> void;
 
-  auto CreatePellets(SDL_Renderer *renderer) -> void;
+  /// Returns the remaining pellets, regular and power.
+  auto Pellets() const -> PelletBoard { return pellets_ | powerPellets_; }
 
+  /// Returns the number of pellets the grid was created with, regular and power.
+  auto InitialPelletCount() const -> std::size_t { return initialPellets_.count() + initialPowerPellets_.count(); }
+
+  /// Returns the number of pellets left.
+  auto PelletsLeft() const -> std::size_t { return pellets_.count() + powerPellets_.count(); }
+
+  /// Returns true while any pellet remains.
+  auto AnyPelletsLeft() const -> bool { return pellets_.any() || powerPellets_.any(); }
+
+  /// Returns every cell in row-major order, reflecting pellets eaten so far.
+  auto Cells() const -> std::span<const Cell, kGridCells> { return cells_; }
+
+  /// Returns the moves out of (x, y) for Pacman and bots: the neighbours that
+  /// are neither walls nor the gate. Neighbours wrap at the edges of kTunnelRow.
+  /// Off the board, which only happens inside the tunnel, every move is open.
+  auto Exits(int x, int y) const -> MoveMask { return InBounds(x, y) ? navigation_->exits[Index(x, y)] : kAllMoves; }
+  auto Exits(const Vec2 &position) const -> MoveMask {
+    if (position.x < 0 || position.y < 0) {
+      return kAllMoves;
+    }
+    return Exits(static_cast<int>(position.x), static_cast<int>(position.y));
+  }
+
+  /// Exits with the gate open, as it is for ghosts.
+  auto GhostExits(int x, int y) const -> MoveMask {
+    return InBounds(x, y) ? navigation_->ghostExits[Index(x, y)] : kAllMoves;
+  }
+  auto GhostExits(const Vec2 &position) const -> MoveMask {
+    if (position.x < 0 || position.y < 0) {
+      return kAllMoves;
+    }
+    return GhostExits(static_cast<int>(position.x), static_cast<int>(position.y));
+  }
+
+  /// Exits of every cell in row-major order.
+  auto ExitTable() const -> std::span<const MoveMask, kGridCells> { return navigation_->exits; }
+
+  /// GhostExits of every cell in row-major order.
+  auto GhostExitTable() const -> std::span<const MoveMask, kGridCells> { return navigation_->ghostExits; }
+
+  /// Returns the first step of a shortest path from (x, y) to kGhostStartCells[ghost],
+  /// one table read. Paths go through the pen gate and may wrap through the tunnel
+  /// on kTunnelRow. kNeutral on the start cell itself, on walls, off the board, and
+  /// where the start cell cannot be reached.
+  auto HeadingHome(int x, int y, std::size_t ghost) const -> Direction {
+    return InBounds(x, y) ? static_cast<Direction>(navigation_->homeHeadings[ghost][Index(x, y)]) : Direction::kNeutral;
+  }
+  auto HeadingHome(const Vec2 &position, std::size_t ghost) const -> Direction {
+    if (position.x < 0 || position.y < 0) {
+      return Direction::kNeutral;
+    }
+    return HeadingHome(static_cast<int>(position.x), static_cast<int>(position.y), ghost);
+  }
+
+  auto Walls() const -> const CellBoard & { return walls_; }
+  auto Gate() const -> const CellBoard & { return gate_; }
+  auto RegularPellets() const -> const CellBoard & { return pellets_; }
+  auto PowerPellets() const -> const CellBoard & { return powerPellets_; }
+
+  /// Sets pellet occupancy from a board returned by Pellets(). Cells keep the
+  /// pellet kind they were created with; bits on cells that started without a
+  /// pellet are ignored.
+  auto RestorePellets(const PelletBoard &board) -> void;
+
+  /// Reads a maze text file. The default maze is compiled in (see default-maze.h);
+  /// this is for other layouts, e.g. when building level packs. Throws
+  /// std::runtime_error if the file cannot be opened and std::invalid_argument if
+  /// it is not kGridWidth x kGridHeight.
   auto static Load(const std::string &gridPath) -> std::vector<std::vector<Cell>>;
 
 private:
-  std::vector<std::vector<Cell>> cells;
-  std::unordered_map<Vec2, std::unique_ptr<Pellet>, Vec2Hash> pellets;
+  std::array<Cell, kGridCells> cells_{};
+  CellBoard walls_;
+  CellBoard gate_;
+  CellBoard pellets_;
+  CellBoard powerPellets_;
+  CellBoard initialPellets_;
+  CellBoard initialPowerPellets_;
+  std::shared_ptr<const MazeNavigation> navigation_;
 };
 
-#endif
\ No newline at end of file
+#endif
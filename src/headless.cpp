@@ -0,0 +1,148 @@
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "constants.h"
+#include "level-pack.h"
+#include "simulation.h"
+#include "sound-sink.h"
+
+// Exit codes
+enum class ExitCode { Success = 0, RuntimeError = 1, UsageError = 2 };
+
+struct HeadlessOptions {
+  int games{100};
+  int maxTicksPerGame{60 * 60 * static_cast<int>(kFramesPerSecond)};
+  int tickRate{static_cast<int>(kFramesPerSecond)};
+  unsigned int seed{1};
+  std::string levels; // level pack to cycle through, one level per game
+};
+
+/// Picks a new random heading a few times per second, which is enough to clear
+/// pellets and meet ghosts without a real bot.
+class RandomWalker {
+public:
+  explicit RandomWalker(unsigned int seed) : rng_{seed} {}
+
+  auto Next() -> Direction {
+    if (turn_(rng_) == 0) {
+      heading_ = static_cast<Direction>(1 + direction_(rng_));
+    }
+    return heading_;
+  }
+
+private:
+  std::mt19937 rng_;
+  std::uniform_int_distribution<int> turn_{0, 15};
+  std::uniform_int_distribution<int> direction_{0, 3};
+  Direction heading_{Direction::kWest};
+};
+
+auto parseOptions(int argc, char *argv[], HeadlessOptions &options) -> bool {
+  for (int i = 1; i < argc; ++i) {
+    std::string_view arg{argv[i]};
+    if (i + 1 >= argc) {
+      return false;
+    }
+
+    if (arg == "--games") {
+      options.games = std::atoi(argv[++i]);
+    } else if (arg == "--max-ticks") {
+      options.maxTicksPerGame = std::atoi(argv[++i]);
+    } else if (arg == "--tick-rate") {
+      options.tickRate = std::atoi(argv[++i]);
+    } else if (arg == "--seed") {
+      options.seed = static_cast<unsigned int>(std::atoi(argv[++i]));
+    } else if (arg == "--levels") {
+      options.levels = argv[++i];
+    } else {
+      return false;
+    }
+  }
+
+  return options.games > 0 && options.maxTicksPerGame > 0 && options.tickRate > 0;
+}
+
+/**
+ * Plays complete games without a window or audio as fast as the CPU allows
+ * and reports simulation throughput.
+ *
+ * Usage: pacman_headless [--games N] [--max-ticks N] [--tick-rate HZ] [--seed N] [--levels PACK]
+ */
+auto main(int argc, char *argv[]) -> int {
+  HeadlessOptions options;
+  if (!parseOptions(argc, argv, options)) {
+    std::cerr << "usage: " << argv[0] << " [--games N] [--max-ticks N] [--tick-rate HZ] [--seed N] [--levels PACK]\n";
+    return static_cast<int>(ExitCode::UsageError);
+  }
+
+  try {
+    const float deltaTime = 1.0f / static_cast<float>(options.tickRate);
+
+    NullSoundSink sound;
+    Simulation simulation{sound};
+
+    // Each level's Grid, and so its navigation tables, is built once and shared
+    // by every game played on it
+    std::vector<Grid> levels;
+    if (!options.levels.empty()) {
+      LevelPack pack{options.levels};
+      if (pack.Size() == 0) {
+        throw std::runtime_error("Level pack has no levels: " + options.levels);
+      }
+      levels.reserve(pack.Size());
+      for (std::size_t level = 0; level < pack.Size(); ++level) {
+        levels.push_back(pack.Load(level));
+      }
+    }
+    RandomWalker walker{options.seed};
+
+    long long totalTicks = 0;
+    long long totalScore = 0;
+    int levelsCleared = 0;
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (int game = 0; game < options.games; ++game) {
+      if (!levels.empty()) {
+        simulation.LoadMaze(levels[static_cast<std::size_t>(game) % levels.size()]);
+      } else {
+        simulation.NewGame();
+      }
+
+      for (int tick = 0; tick < options.maxTicksPerGame; ++tick) {
+        simulation.ProcessInput(walker.Next());
+        auto status = simulation.Step(deltaTime);
+        ++totalTicks;
+
+        if (status == SimulationStatus::kLevelComplete) {
+          levelsCleared += 1;
+        }
+        if (simulation.Resolve(status)) {
+          break;
+        }
+      }
+
+      totalScore += simulation.GetContext().score;
+    }
+
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "games:          " << options.games << "\n"
+              << "ticks:          " << totalTicks << "\n"
+              << "levels cleared: " << levelsCleared << "\n"
+              << "mean score:     " << static_cast<double>(totalScore) / options.games << "\n"
+              << "elapsed (s):    " << elapsed << "\n"
+              << "ticks/s:        " << static_cast<double>(totalTicks) / elapsed << "\n";
+
+    return static_cast<int>(ExitCode::Success);
+  } catch (const std::exception &e) {
+    std::cerr << "Unhandled Exception: " << e.what() << std::endl;
+    return static_cast<int>(ExitCode::RuntimeError);
+  }
+}
@@ -0,0 +1,51 @@
+#include <filesystem>
+#include <iostream>
+#include <string_view>
+
+#include "level-pack.h"
+
+// Exit codes
+enum class ExitCode { Success = 0, RuntimeError = 1, UsageError = 2 };
+
+auto listPack(const std::string &path) -> void {
+  LevelPack pack{path};
+  std::cout << path << ": " << pack.Size() << " levels\n";
+  for (std::size_t level = 0; level < pack.Size(); ++level) {
+    std::cout << "  " << level << " " << pack.Name(level) << " (" << pack.PelletCount(level) << " pellets)\n";
+  }
+}
+
+/**
+ * Converts text mazes (the assets/maze.txt format) into a binary level pack, or
+ * lists the levels of an existing pack. Converted levels are named after their
+ * file; they play with the arcade maze's start cells, pen and tunnel.
+ *
+ * Usage: pacman_levelpack OUTPUT MAZE... | pacman_levelpack --list PACK
+ */
+auto main(int argc, char *argv[]) -> int {
+  if (argc < 3) {
+    std::cerr << "usage: " << argv[0] << " OUTPUT MAZE...\n"
+              << "       " << argv[0] << " --list PACK\n";
+    return static_cast<int>(ExitCode::UsageError);
+  }
+
+  try {
+    if (std::string_view{argv[1]} == "--list") {
+      listPack(argv[2]);
+      return static_cast<int>(ExitCode::Success);
+    }
+
+    LevelPackWriter writer;
+    for (int i = 2; i < argc; ++i) {
+      auto name = std::filesystem::path{argv[i]}.stem().string();
+      writer.Add(name, Grid{Grid::Load(argv[i])});
+    }
+    writer.Save(argv[1]);
+
+    std::cout << "Wrote " << writer.Size() << " levels to " << argv[1] << "\n";
+    return static_cast<int>(ExitCode::Success);
+  } catch (const std::exception &e) {
+    std::cerr << "Unhandled Exception: " << e.what() << std::endl;
+    return static_cast<int>(ExitCode::RuntimeError);
+  }
+}
@@ -0,0 +1,111 @@
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+#include "level-pack.h"
+
+namespace {
+
+auto validCell(Cell cell) -> bool { return static_cast<unsigned char>(cell) < static_cast<unsigned char>(Cell::kOffGrid); }
+
+auto isPellet(Cell cell) -> bool { return cell == Cell::kPellet || cell == Cell::kPowerPellet; }
+
+auto countPellets(std::span<const Cell, kGridCells> cells) -> std::size_t {
+  return static_cast<std::size_t>(std::count_if(cells.begin(), cells.end(), isPellet));
+}
+
+} // namespace
+
+auto LevelPackWriter::Add(std::string_view name, const Grid &grid) -> void {
+  if (name.size() >= kLevelNameSize) {
+    throw std::invalid_argument("level name must be shorter than " + std::to_string(kLevelNameSize) + " characters");
+  }
+
+  // Pellets are counted from the initial layout, not whatever the grid has left
+  Grid initial{grid};
+  initial.Reset();
+
+  LevelRecord record{};
+  std::copy(name.begin(), name.end(), record.name.begin());
+  record.cellsOffset = cells_.size(); // relative to the cell section until Save
+  record.pelletCount = static_cast<std::uint32_t>(countPellets(initial.Cells()));
+  records_.push_back(record);
+
+  cells_.insert(cells_.end(), initial.Cells().begin(), initial.Cells().end());
+}
+
+auto LevelPackWriter::Save(const std::string &path) const -> void {
+  LevelPackHeader header{};
+  header.magic = kLevelPackMagic;
+  header.version = kLevelPackVersion;
+  header.levelCount = static_cast<std::uint32_t>(records_.size());
+  header.width = kGridWidth;
+  header.height = kGridHeight;
+  header.indexOffset = sizeof(LevelPackHeader);
+
+  auto cellsOffset = header.indexOffset + records_.size() * sizeof(LevelRecord);
+  auto index = records_;
+  for (auto &record : index) {
+    record.cellsOffset += cellsOffset;
+  }
+
+  std::ofstream file{path, std::ios::binary | std::ios::trunc};
+  if (!file.is_open()) {
+    throw std::runtime_error("Unable to write level pack: " + path);
+  }
+
+  file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+  file.write(reinterpret_cast<const char *>(index.data()),
+             static_cast<std::streamsize>(index.size() * sizeof(LevelRecord)));
+  file.write(reinterpret_cast<const char *>(cells_.data()), static_cast<std::streamsize>(cells_.size()));
+
+  if (!file) {
+    throw std::runtime_error("Unable to write level pack: " + path);
+  }
+}
+
+LevelPack::LevelPack(const std::string &path) : file_{path} {
+  LevelPackHeader header{};
+  if (file_.Size() < sizeof(header)) {
+    throw std::runtime_error("Not a level pack: " + path);
+  }
+  std::memcpy(&header, file_.Data(), sizeof(header));
+
+  if (header.magic != kLevelPackMagic) {
+    throw std::runtime_error("Not a level pack: " + path);
+  }
+  if (header.version != kLevelPackVersion || header.width != kGridWidth || header.height != kGridHeight) {
+    throw std::runtime_error("Level pack was written for an incompatible build: " + path);
+  }
+
+  // Compared without adding to indexOffset, which comes from the file and could wrap
+  if (header.indexOffset > file_.Size() ||
+      header.levelCount > (file_.Size() - header.indexOffset) / sizeof(LevelRecord) ||
+      header.indexOffset % alignof(LevelRecord) != 0) {
+    throw std::runtime_error("Level pack is truncated or corrupt: " + path);
+  }
+
+  // mmap and the fallback buffer are both suitably aligned for the offset checked above
+  index_ = {reinterpret_cast<const LevelRecord *>(file_.Data() + header.indexOffset), header.levelCount};
+
+  for (const auto &record : index_) {
+    if (record.cellsOffset > file_.Size() || file_.Size() - record.cellsOffset < kGridCells ||
+        record.name.back() != '\0') {
+      throw std::runtime_error("Level pack is truncated or corrupt: " + path);
+    }
+
+    const auto *cells = cellsAt(record);
+    if (!std::all_of(cells, cells + kGridCells, validCell)) {
+      throw std::runtime_error("Level pack holds unknown cell values: " + path);
+    }
+    if (countPellets(std::span<const Cell, kGridCells>{cells, kGridCells}) != record.pelletCount) {
+      throw std::runtime_error("Level pack pellet count does not match its cells: " + path);
+    }
+  }
+}
+
+auto LevelPack::Name(std::size_t level) const -> std::string_view {
+  const auto &name = index_[level].name;
+  return {name.data(), static_cast<std::size_t>(std::find(name.begin(), name.end(), '\0') - name.begin())};
+}
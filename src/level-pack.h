@@ -0,0 +1,101 @@
+#ifndef LEVEL_PACK_H
+#define LEVEL_PACK_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "grid.h"
+#include "mapped-file.h"
+
+/*
+ * Level pack file layout. All fields are in host byte order.
+ *
+ *   LevelPackHeader
+ *   LevelRecord[levelCount]         at indexOffset
+ *   Cell[kGridCells] per level      row-major, at each record's cellsOffset
+ *
+ * Cells are stored as the raw Cell values, so a mapped pack is read in place:
+ * opening a pack validates it once and a level's cells are a span into the file.
+ */
+
+inline constexpr std::array<char, 8> kLevelPackMagic{'P', 'A', 'C', 'L', 'E', 'V', 'E', 'L'};
+inline constexpr std::uint32_t kLevelPackVersion = 2;
+inline constexpr std::size_t kLevelNameSize = 32;
+
+struct LevelPackHeader {
+  std::array<char, 8> magic;
+  std::uint32_t version;
+  std::uint32_t levelCount;
+  std::uint32_t width;
+  std::uint32_t height;
+  std::uint64_t indexOffset;
+};
+
+/// One entry of the pack index. Start cells, scatter cells, the pen and the
+/// tunnel are not stored: the actors read them from constants.h, so every level
+/// shares the arcade maze's landmarks.
+struct LevelRecord {
+  std::array<char, kLevelNameSize> name; // NUL padded
+  std::uint64_t cellsOffset;
+  std::uint32_t pelletCount; // pellets and energizers in the cells
+  std::uint32_t reserved;
+};
+
+static_assert(sizeof(Cell) == 1, "cells are stored as single bytes");
+static_assert(std::is_trivially_copyable_v<LevelPackHeader> && std::is_trivially_copyable_v<LevelRecord>);
+static_assert(sizeof(LevelPackHeader) % alignof(LevelRecord) == 0, "the index follows the header");
+
+/// Collects levels in memory and writes them as a pack.
+class LevelPackWriter {
+public:
+  /// Adds the initial layout of `grid` and its pellet count. Throws
+  /// std::invalid_argument if the name does not fit the index.
+  auto Add(std::string_view name, const Grid &grid) -> void;
+
+  auto Size() const -> std::size_t { return records_.size(); }
+
+  /// Writes the pack. Throws std::runtime_error if the file cannot be written.
+  auto Save(const std::string &path) const -> void;
+
+private:
+  std::vector<LevelRecord> records_;
+  std::vector<Cell> cells_;
+};
+
+/// Read-only view of a level pack. The file is mapped and checked once when it is
+/// opened; after that, looking up a level copies nothing and reads nothing from disk.
+class LevelPack {
+public:
+  /// Opens `path`. Throws std::runtime_error if it is not a valid pack for this build,
+  /// including when a level's stored pellet count does not match its cells.
+  explicit LevelPack(const std::string &path);
+
+  auto Size() const -> std::size_t { return index_.size(); }
+
+  auto Name(std::size_t level) const -> std::string_view;
+  auto PelletCount(std::size_t level) const -> std::size_t { return index_[level].pelletCount; }
+
+  /// Returns the level's cells in row-major order, pointing into the mapped file.
+  auto Cells(std::size_t level) const -> std::span<const Cell, kGridCells> {
+    return std::span<const Cell, kGridCells>{cellsAt(index_[level]), kGridCells};
+  }
+
+  /// Builds a Grid for the level.
+  auto Load(std::size_t level) const -> Grid { return Grid{Cells(level)}; }
+
+private:
+  auto cellsAt(const LevelRecord &record) const -> const Cell * {
+    return reinterpret_cast<const Cell *>(file_.Data() + record.cellsOffset);
+  }
+
+  MappedFile file_;
+  std::span<const LevelRecord> index_;
+};
+
+#endif
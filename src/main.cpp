@@ -18,9 +18,19 @@ auto main() -> int {
     const char *env = std::getenv("ASSET_PATH");
     AssetManager assetManager{env ? env : "../assets"};
 
+    const char *tickRate = std::getenv("TICK_RATE");
+    auto ticksPerSecond = tickRate ? std::stoul(tickRate) : kFramesPerSecond;
+
     auto game = Game{assetManager};
 
-    game.Run(kFrameDuration);
+    if (const char *replay = std::getenv("PLAY_REPLAY")) {
+      game.PlayFrom(replay);
+    }
+    if (const char *record = std::getenv("RECORD_REPLAY")) {
+      game.RecordTo(record);
+    }
+
+    game.Run(ticksPerSecond, kMinFrameDuration);
     std::cout << "Game has terminated successfully.\n";
 
     return static_cast<int>(ExitCode::Success);
@@ -0,0 +1,63 @@
+#include <fstream>
+#include <stdexcept>
+
+#include "mapped-file.h"
+
+#if defined(_WIN32)
+
+MappedFile::MappedFile(const std::string &path) {
+  std::ifstream file{path, std::ios::binary | std::ios::ate};
+  if (!file.is_open()) {
+    throw std::runtime_error("Unable to open " + path);
+  }
+
+  buffer_.resize(static_cast<std::size_t>(file.tellg()));
+  file.seekg(0);
+  file.read(reinterpret_cast<char *>(buffer_.data()), static_cast<std::streamsize>(buffer_.size()));
+
+  data_ = buffer_.data();
+  size_ = buffer_.size();
+}
+
+MappedFile::~MappedFile() = default;
+
+#else
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+MappedFile::MappedFile(const std::string &path) {
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw std::runtime_error("Unable to open " + path);
+  }
+
+  struct stat info {};
+  if (fstat(fd, &info) != 0) {
+    close(fd);
+    throw std::runtime_error("Unable to stat " + path);
+  }
+
+  size_ = static_cast<std::size_t>(info.st_size);
+  if (size_ > 0) {
+    void *mapping = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (mapping == MAP_FAILED) {
+      close(fd);
+      throw std::runtime_error("Unable to map " + path);
+    }
+    data_ = static_cast<const std::byte *>(mapping);
+  }
+
+  // The mapping stays valid after the descriptor is closed
+  close(fd);
+}
+
+MappedFile::~MappedFile() {
+  if (data_ != nullptr) {
+    munmap(const_cast<std::byte *>(data_), size_);
+  }
+}
+
+#endif
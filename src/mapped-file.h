@@ -0,0 +1,28 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/// Read-only view of a whole file. The file is memory-mapped on POSIX systems, so
+/// opening it costs no parsing or copying; elsewhere it is read into memory.
+class MappedFile {
+public:
+  /// Opens and maps `path`. Throws std::runtime_error if it cannot be read.
+  explicit MappedFile(const std::string &path);
+  ~MappedFile();
+
+  MappedFile(const MappedFile &) = delete;
+  MappedFile &operator=(const MappedFile &) = delete;
+
+  auto Data() const -> const std::byte * { return data_; }
+  auto Size() const -> std::size_t { return size_; }
+
+private:
+  const std::byte *data_{nullptr};
+  std::size_t size_{0};
+  std::vector<std::byte> buffer_; // only used where mmap is unavailable
+};
+
+#endif
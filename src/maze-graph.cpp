@@ -0,0 +1,173 @@
+#include <algorithm>
+#include <deque>
+#include <stdexcept>
+
+#include "maze-graph.h"
+
+namespace {
+
+struct Step {
+  int dx;
+  int dy;
+  Direction heading;
+};
+
+constexpr std::array<Step, 4> kSteps{{
+    {0, -1, Direction::kNorth},
+    {0, 1, Direction::kSouth},
+    {1, 0, Direction::kEast},
+    {-1, 0, Direction::kWest},
+}};
+
+} // namespace
+
+MazeGraph::MazeGraph(const Grid &grid) {
+  collectCells(grid);
+  fillDistances();
+  buildJunctions();
+}
+
+auto MazeGraph::neighbours(GridPoint cell, std::array<GridPoint, 4> &out, std::array<Direction, 4> &headings) const
+    -> int {
+  int count = 0;
+  for (const auto &step : kSteps) {
+    GridPoint next{cell.x + step.dx, cell.y + step.dy};
+
+    // The tunnel joins the two ends of its row
+    if (next.y == kTunnelRow && next.x < 0) {
+      next.x = kGridWidth - 1;
+    } else if (next.y == kTunnelRow && next.x >= kGridWidth) {
+      next.x = 0;
+    }
+
+    if (nodeAt(next.x, next.y) >= 0) {
+      out[count] = next;
+      headings[count] = step.heading;
+      count++;
+    }
+  }
+  return count;
+}
+
+auto MazeGraph::collectCells(const Grid &grid) -> void {
+  // Flood fill from Pacman's start over every non-wall cell. nodeOf_ temporarily marks
+  // walkable cells with 0 so neighbours() can see them.
+  nodeOf_.fill(-1);
+  for (int y = 0; y < kGridHeight; ++y) {
+    for (int x = 0; x < kGridWidth; ++x) {
+      if (!grid.IsWall(x, y)) {
+        nodeOf_[Grid::Index(x, y)] = 0;
+      }
+    }
+  }
+
+  std::array<bool, kGridCells> visited{};
+  std::deque<GridPoint> frontier{{static_cast<int>(kPacmanHomeCell.x), static_cast<int>(kPacmanHomeCell.y)}};
+  visited[Grid::Index(frontier.front().x, frontier.front().y)] = true;
+
+  std::array<GridPoint, 4> next{};
+  std::array<Direction, 4> headings{};
+  while (!frontier.empty()) {
+    auto cell = frontier.front();
+    frontier.pop_front();
+    nodes_.push_back(cell);
+
+    auto count = neighbours(cell, next, headings);
+    for (int i = 0; i < count; ++i) {
+      auto index = Grid::Index(next[i].x, next[i].y);
+      if (!visited[index]) {
+        visited[index] = true;
+        frontier.push_back(next[i]);
+      }
+    }
+  }
+
+  // Row-major table order keeps rows of nearby cells close in memory
+  std::sort(nodes_.begin(), nodes_.end(),
+            [](const GridPoint &a, const GridPoint &b) { return Grid::Index(a.x, a.y) < Grid::Index(b.x, b.y); });
+
+  nodeOf_.fill(-1);
+  for (std::size_t i = 0; i < nodes_.size(); ++i) {
+    nodeOf_[Grid::Index(nodes_[i].x, nodes_[i].y)] = static_cast<std::int16_t>(i);
+  }
+}
+
+auto MazeGraph::fillDistances() -> void {
+  const auto count = nodes_.size();
+  distances_.assign(count * count, kNoPath);
+
+  std::vector<int> frontier;
+  frontier.reserve(count);
+  std::array<GridPoint, 4> next{};
+  std::array<Direction, 4> headings{};
+
+  // One breadth-first search per source cell
+  for (std::size_t source = 0; source < count; ++source) {
+    auto *row = distances_.data() + source * count;
+    row[source] = 0;
+
+    frontier.clear();
+    frontier.push_back(static_cast<int>(source));
+    for (std::size_t head = 0; head < frontier.size(); ++head) {
+      auto node = frontier[head];
+      auto steps = row[node];
+      if (steps + 1 >= kNoPath) {
+        throw std::invalid_argument("maze paths are too long for the distance table");
+      }
+
+      auto neighbourCount = neighbours(nodes_[node], next, headings);
+      for (int i = 0; i < neighbourCount; ++i) {
+        auto target = nodeAt(next[i].x, next[i].y);
+        if (row[target] == kNoPath) {
+          row[target] = static_cast<std::uint8_t>(steps + 1);
+          frontier.push_back(target);
+        }
+      }
+    }
+  }
+}
+
+auto MazeGraph::buildJunctions() -> void {
+  std::array<GridPoint, 4> next{};
+  std::array<Direction, 4> headings{};
+
+  junctionOf_.fill(-1);
+  for (const auto &cell : nodes_) {
+    if (neighbours(cell, next, headings) != 2) {
+      junctionOf_[Grid::Index(cell.x, cell.y)] = static_cast<std::int16_t>(junctions_.size());
+      junctions_.push_back(Junction{.cell = cell, .edges = {}, .degree = 0});
+    }
+  }
+
+  // Follow each corridor out of each junction until it reaches another junction
+  for (auto &junction : junctions_) {
+    auto exits = neighbours(junction.cell, next, headings);
+    for (int i = 0; i < exits; ++i) {
+      auto previous = junction.cell;
+      auto current = next[i];
+      int length = 1;
+
+      std::array<GridPoint, 4> ahead{};
+      std::array<Direction, 4> aheadHeadings{};
+      while (JunctionAt(current.x, current.y) < 0) {
+        // A corridor visits each cell at most once, so a longer walk is going round a loop
+        if (static_cast<std::size_t>(length) > nodes_.size()) {
+          throw std::invalid_argument("maze corridor loops without reaching a junction");
+        }
+        neighbours(current, ahead, aheadHeadings);
+        auto step = ahead[0] == previous ? ahead[1] : ahead[0];
+        previous = current;
+        current = step;
+        length++;
+      }
+
+      junction.edges[junction.degree++] =
+          JunctionEdge{.to = JunctionAt(current.x, current.y), .length = length, .heading = headings[i]};
+    }
+  }
+}
+
+auto MazeGraph::MemoryFootprint() const -> std::size_t {
+  return sizeof(nodeOf_) + sizeof(junctionOf_) + nodes_.size() * sizeof(GridPoint) + distances_.size() * sizeof(std::uint8_t) +
+         junctions_.size() * sizeof(Junction);
+}
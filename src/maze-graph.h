@@ -0,0 +1,94 @@
+#ifndef MAZE_GRAPH_H
+#define MAZE_GRAPH_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "constants.h"
+#include "grid.h"
+
+/// Integer cell coordinates.
+struct GridPoint {
+  int x;
+  int y;
+
+  auto operator==(const GridPoint &) const -> bool = default;
+};
+
+/// A corridor leaving a junction.
+struct JunctionEdge {
+  int to;             ///< Index of the junction the corridor leads to
+  int length;         ///< Steps along the corridor
+  Direction heading;  ///< Direction of the first step
+};
+
+/// A cell where the maze branches or dead-ends (any walkable cell without exactly two walkable neighbours).
+struct Junction {
+  GridPoint cell;
+  std::array<JunctionEdge, 4> edges;
+  int degree; ///< Number of valid entries in edges
+};
+
+/// Navigation data for one maze, built once from a Grid: the walkable cells
+/// reachable from Pacman's start (gate and pen included, the tunnel on kTunnelRow
+/// wrapping from column 0 to the last column), the junction graph over them, and
+/// a dense table of shortest-path step counts between every pair of those cells.
+/// Distance lookups are two array reads.
+class MazeGraph {
+public:
+  /// Returned by Distance when either cell is a wall, off the board or unreachable.
+  static constexpr int kUnreachable = -1;
+
+  /// Builds the graph and distance table. Throws std::invalid_argument if the
+  /// maze's longest shortest path does not fit the table's byte entries, or if
+  /// a corridor walk runs longer than the maze without reaching a junction.
+  explicit MazeGraph(const Grid &grid);
+
+  /// Returns the number of maze steps between two cells, or kUnreachable.
+  auto Distance(int fromX, int fromY, int toX, int toY) const -> int {
+    auto from = nodeAt(fromX, fromY);
+    auto to = nodeAt(toX, toY);
+    if (from < 0 || to < 0) {
+      return kUnreachable;
+    }
+    auto steps = distances_[static_cast<std::size_t>(from) * nodes_.size() + static_cast<std::size_t>(to)];
+    return steps == kNoPath ? kUnreachable : steps;
+  }
+
+  /// Cell-unit overload, for positions from Ghost::GetCell and Pacman::GetCell.
+  auto Distance(const Vec2 &from, const Vec2 &to) const -> int {
+    return Distance(static_cast<int>(from.x), static_cast<int>(from.y), static_cast<int>(to.x), static_cast<int>(to.y));
+  }
+
+  /// Returns the walkable cells covered by the table, in table order.
+  auto Cells() const -> std::span<const GridPoint> { return nodes_; }
+
+  auto Junctions() const -> std::span<const Junction> { return junctions_; }
+
+  /// Returns the index into Junctions() of the junction at (x, y), or -1.
+  auto JunctionAt(int x, int y) const -> int { return Grid::InBounds(x, y) ? junctionOf_[Grid::Index(x, y)] : -1; }
+
+  /// Bytes held by the lookup tables.
+  auto MemoryFootprint() const -> std::size_t;
+
+private:
+  static constexpr std::uint8_t kNoPath = UINT8_MAX;
+
+  auto nodeAt(int x, int y) const -> int { return Grid::InBounds(x, y) ? nodeOf_[Grid::Index(x, y)] : -1; }
+  auto neighbours(GridPoint cell, std::array<GridPoint, 4> &out, std::array<Direction, 4> &headings) const -> int;
+
+  auto collectCells(const Grid &grid) -> void;
+  auto fillDistances() -> void;
+  auto buildJunctions() -> void;
+
+  std::array<std::int16_t, kGridCells> nodeOf_{}; // table index of each board cell, -1 if not walkable
+  std::array<std::int16_t, kGridCells> junctionOf_{}; // index into junctions_, -1 elsewhere
+  std::vector<GridPoint> nodes_;
+  std::vector<std::uint8_t> distances_; // nodes_.size() squared, row per source cell
+  std::vector<Junction> junctions_;
+};
+
+#endif
@@ -0,0 +1,58 @@
+#include <cmath>
+
+#include "movement.h"
+
+#if defined(PACMAN_FIXED_POINT)
+namespace {
+
+constexpr Subpixels kCellMask = (Subpixels{1} << kCellShift) - 1;
+constexpr Subpixels kHalfCell = Subpixels{kCellSize / 2} << kSubpixelBits;
+
+} // namespace
+#endif
+
+auto StridesFor(int level, [[maybe_unused]] std::uint32_t tick, [[maybe_unused]] float deltaTime) -> Strides {
+  const auto tier = SpeedTier(level);
+  Strides strides;
+  for (std::size_t speed = 0; speed < kSpeedCount; ++speed) {
+#if defined(PACMAN_FIXED_POINT)
+    strides.bySpeed[speed] = kSpeedPatterns[tier][speed].Stride(tick);
+#else
+    strides.bySpeed[speed] = kSpeeds[tier][speed] * deltaTime;
+#endif
+  }
+  return strides;
+}
+
+auto Advance(const Position &position, const Vec2 &velocity, Coord stride) -> Position {
+  auto along = [stride](float axis) -> Coord { return axis > 0 ? stride : axis < 0 ? -stride : Coord{0}; };
+  return {.x = position.x + along(velocity.x), .y = position.y + along(velocity.y)};
+}
+
+auto CellOf(const Position &position) -> Vec2 {
+#if defined(PACMAN_FIXED_POINT)
+  // Arithmetic shifts floor, so cells left of the board are negative as with std::floor
+  return {.x = static_cast<float>(position.x >> kCellShift), .y = static_cast<float>(position.y >> kCellShift)};
+#else
+  return (ToVec2(position) / kCellSize).Floor();
+#endif
+}
+
+auto CellCenter(Coord pos) -> Coord {
+#if defined(PACMAN_FIXED_POINT)
+  return (pos & ~kCellMask) + kHalfCell;
+#else
+  // Floors like the fixed-point mask, so tunnel positions left of the board agree
+  return std::floor(pos / kCellSize) * kCellSize + (kCellSize / 2);
+#endif
+}
+
+auto BoundUpper(Coord pos) -> Coord {
+  auto max = CellCenter(pos);
+  return pos > max ? max : pos;
+}
+
+auto BoundLower(Coord pos) -> Coord {
+  auto min = CellCenter(pos);
+  return pos < min ? min : pos;
+}
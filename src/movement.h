@@ -0,0 +1,178 @@
+#ifndef MOVEMENT_H
+#define MOVEMENT_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "constants.h"
+#include "grid.h"
+#include "vector2.h"
+
+// Movement primitives shared by Pacman and the ghosts: advancing along a
+// heading, finding the cell under a position, and snapping to cell centres.
+//
+// By default positions are float pixels. Configuring with -DPACMAN_FIXED_POINT=ON
+// switches to a fixed-point model: actors store their position as whole
+// subpixels (1/4096 px), every tick adds a whole number of subpixels taken from a
+// per-level speed pattern, and cell and centre tests are integer shifts and
+// masks. Nothing about movement rounds, so games play out bit-identically
+// whatever the compiler, optimisation level or thread count. Positions leave the
+// actors as Vec2 (every subpixel on the board is exact in a float), so
+// snapshots and views are the same in both builds.
+
+#if defined(PACMAN_FIXED_POINT)
+inline constexpr bool kFixedPointMovement = true;
+#else
+inline constexpr bool kFixedPointMovement = false;
+#endif
+
+/// Fixed-point position along one axis.
+using Subpixels = std::int32_t;
+
+inline constexpr int kSubpixelBits = 12;
+inline constexpr Subpixels kSubpixelsPerPixel = Subpixels{1} << kSubpixelBits;
+
+/// Shift from subpixels to cells; kCellSize is a power of two.
+inline constexpr int kCellShift = kSubpixelBits + 3;
+static_assert((1 << (kCellShift - kSubpixelBits)) == kCellSize, "kCellSize must be 8 pixels");
+
+// Every subpixel of the board, tunnel margins included, must be exact in a float
+static_assert(((kGridWidth * kCellSize + 64) << kSubpixelBits) < (1 << 24));
+static_assert(((kGridHeight * kCellSize + 64) << kSubpixelBits) < (1 << 24));
+
+#if defined(PACMAN_FIXED_POINT)
+/// An actor's coordinate along one axis: whole subpixels.
+using Coord = Subpixels;
+#else
+/// An actor's coordinate along one axis: pixels.
+using Coord = float;
+#endif
+
+/// Converts pixels to a Coord. Exact for multiples of 1/4096 px, which covers
+/// every cell corner and centre and every position the fixed-point model produces.
+constexpr auto FromPixels(float pixels) -> Coord {
+  if constexpr (kFixedPointMovement) {
+    return static_cast<Coord>(pixels * static_cast<float>(kSubpixelsPerPixel));
+  } else {
+    return pixels;
+  }
+}
+
+constexpr auto ToPixels(Subpixels subpixels) -> float {
+  return static_cast<float>(subpixels) / static_cast<float>(kSubpixelsPerPixel);
+}
+
+constexpr auto ToPixels(float pixels) -> float { return pixels; }
+
+/// Where an actor is on the board, in Coord units.
+struct Position {
+  Coord x{};
+  Coord y{};
+
+  auto operator==(const Position &) const -> bool = default;
+};
+
+constexpr auto ToPosition(const Vec2 &pixels) -> Position { return {FromPixels(pixels.x), FromPixels(pixels.y)}; }
+
+constexpr auto ToVec2(const Position &position) -> Vec2 {
+  return {.x = ToPixels(position.x), .y = ToPixels(position.y)};
+}
+
+/// The speeds actors move at. Every move is a heading times one of these.
+enum class Speed : std::uint8_t {
+  kPacman,
+  kGhost,
+  kGhostInPen,      ///< Dancing in and leaving the pen, half speed
+  kGhostRespawning, ///< Eyes returning to the pen
+};
+
+inline constexpr std::size_t kSpeedCount = static_cast<std::size_t>(Speed::kGhostRespawning) + 1;
+
+/// Returns the row of kSpeeds and kSpeedPatterns for `level` (0 is the first level).
+constexpr auto SpeedTier(int level) -> std::size_t {
+  return level < 1 ? 0 : level < 4 ? 1 : level < 20 ? 2 : 3;
+}
+
+constexpr auto SpeedsForTier(std::size_t tier) -> std::array<float, kSpeedCount> {
+  const auto ghost = kMaxSpeed * kGhostTierSpeedMultipliers[tier];
+  return {kMaxSpeed * kPacmanTierSpeedMultipliers[tier], ghost, ghost / 2.0f, ghost * kGhostRespawnSpeedMultiplier};
+}
+
+/// Pixels per second of each Speed, by speed tier.
+inline constexpr std::array<std::array<float, kSpeedCount>, kSpeedTiers> kSpeeds{
+    SpeedsForTier(0), SpeedsForTier(1), SpeedsForTier(2), SpeedsForTier(3)};
+
+/// Ticks in one repetition of a speed pattern.
+inline constexpr int kSpeedPatternTicks = 32;
+
+/// Fixed-point movement of one Speed over kSpeedPatternTicks reference ticks:
+/// `base` subpixels every tick, plus one more on each tick whose bit is set in
+/// `extra`. The extra subpixels are spread evenly, so the pattern averages the
+/// exact speed rather than a per-tick step rounded once.
+struct SpeedPattern {
+  Subpixels base;
+  std::uint32_t extra;
+
+  /// Subpixels to move on reference tick `tick`.
+  constexpr auto Stride(std::uint32_t tick) const -> Subpixels {
+    return base + static_cast<Subpixels>((extra >> (tick % kSpeedPatternTicks)) & 1u);
+  }
+};
+
+constexpr auto MakeSpeedPattern(float pixelsPerSecond) -> SpeedPattern {
+  const auto total = static_cast<std::int64_t>(static_cast<double>(pixelsPerSecond) * kSpeedPatternTicks *
+                                                   kSubpixelsPerPixel / kFramesPerSecond +
+                                               0.5);
+  const auto remainder = total % kSpeedPatternTicks;
+
+  std::uint32_t extra = 0;
+  for (std::int64_t tick = 0; tick < kSpeedPatternTicks; ++tick) {
+    if ((tick + 1) * remainder / kSpeedPatternTicks != tick * remainder / kSpeedPatternTicks) {
+      extra |= 1u << tick;
+    }
+  }
+  return {static_cast<Subpixels>(total / kSpeedPatternTicks), extra};
+}
+
+constexpr auto PatternsForTier(std::size_t tier) -> std::array<SpeedPattern, kSpeedCount> {
+  const auto &speeds = kSpeeds[tier];
+  return {MakeSpeedPattern(speeds[0]), MakeSpeedPattern(speeds[1]), MakeSpeedPattern(speeds[2]),
+          MakeSpeedPattern(speeds[3])};
+}
+
+/// Fixed-point speed patterns of each Speed, by speed tier. Built at compile
+/// time, so every build moves actors by the same integers.
+inline constexpr std::array<std::array<SpeedPattern, kSpeedCount>, kSpeedTiers> kSpeedPatterns{
+    PatternsForTier(0), PatternsForTier(1), PatternsForTier(2), PatternsForTier(3)};
+
+/// How far each Speed moves during one update.
+struct Strides {
+  std::array<Coord, kSpeedCount> bySpeed{};
+
+  auto operator[](Speed speed) const -> Coord { return bySpeed[static_cast<std::size_t>(speed)]; }
+};
+
+/// Returns the strides for an update of `deltaTime` seconds on tick `tick` of a
+/// game on `level`. Fixed point: each pattern's stride for `tick`; deltaTime is
+/// not used, as fixed-point Simulation steps are whole ticks. Float: each speed
+/// times deltaTime.
+auto StridesFor(int level, std::uint32_t tick, float deltaTime) -> Strides;
+
+/// Returns `position` moved `stride` along the heading of `velocity`, whose
+/// components are positive, negative or 0.
+auto Advance(const Position &position, const Vec2 &velocity, Coord stride) -> Position;
+
+/// Returns the cell containing `position`, in cell units.
+auto CellOf(const Position &position) -> Vec2;
+
+/// Returns the centre of the cell containing `pos` along one axis.
+auto CellCenter(Coord pos) -> Coord;
+
+/// Returns `pos`, held back to its cell centre if it has passed it.
+auto BoundUpper(Coord pos) -> Coord;
+
+/// Returns `pos`, held forward to its cell centre if it has not reached it.
+auto BoundLower(Coord pos) -> Coord;
+
+#endif
@@ -0,0 +1,130 @@
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+
+#include "observation-encoder.h"
+
+namespace {
+
+constexpr std::array<ObservationPlane, kGhostCount> kGhostPlanes{ObservationPlane::kBlinky, ObservationPlane::kInky,
+                                                                 ObservationPlane::kPinky, ObservationPlane::kClyde};
+
+auto planeForCell(Cell cell) -> std::optional<ObservationPlane> {
+  switch (cell) {
+  case Cell::kWall:
+    return ObservationPlane::kWalls;
+  case Cell::kGate:
+    return ObservationPlane::kGate;
+  case Cell::kPellet:
+    return ObservationPlane::kPellets;
+  case Cell::kPowerPellet:
+    return ObservationPlane::kPowerPellets;
+  default:
+    return std::nullopt;
+  }
+}
+
+} // namespace
+
+ObservationEncoder::ObservationEncoder(const ObservationLayout &layout) : layout_{layout} {
+  if (layout.downsample < 1 || layout.cropWidth < 0 || layout.cropHeight < 0) {
+    throw std::invalid_argument("downsample must be positive and crop sizes non-negative");
+  }
+  // Bounds the window math in Encode, which works in int maze cells
+  auto span = [&](int crop) { return static_cast<std::int64_t>(std::max(crop, 1)) * layout.downsample; };
+  if (span(layout.cropWidth) > kMaxWindowSpan || span(layout.cropHeight) > kMaxWindowSpan) {
+    throw std::invalid_argument("crop size times downsample exceeds the maximum window span");
+  }
+
+  width_ = layout.cropWidth > 0 ? layout.cropWidth : (kGridWidth + layout.downsample - 1) / layout.downsample;
+  height_ = layout.cropHeight > 0 ? layout.cropHeight : (kGridHeight + layout.downsample - 1) / layout.downsample;
+
+  auto cells = static_cast<std::size_t>(width_) * static_cast<std::size_t>(height_);
+  planeBytes_ = layout.format == PlaneFormat::kBits ? (cells + 7) / 8 : cells;
+  if (planeBytes_ > std::numeric_limits<std::size_t>::max() / kPlanes) {
+    throw std::invalid_argument("observation layout is too large");
+  }
+}
+
+auto ObservationEncoder::Encode(const Simulation &simulation, std::span<std::uint8_t> out) const -> void {
+  if (out.size() != Bytes()) {
+    throw std::invalid_argument("ObservationEncoder::Encode buffer must hold Bytes() bytes");
+  }
+  std::memset(out.data(), 0, out.size());
+
+  const auto ds = layout_.downsample;
+  const auto pacmanCell = simulation.GetPacman().GetCell();
+
+  // Top-left maze cell of the window; a crop puts Pacman in its centre output cell
+  const int originX = layout_.cropWidth > 0 ? static_cast<int>(pacmanCell.x) - (width_ / 2) * ds : 0;
+  const int originY = layout_.cropHeight > 0 ? static_cast<int>(pacmanCell.y) - (height_ / 2) * ds : 0;
+
+  // Maps a maze cell to the window; returns false outside it
+  auto toOutput = [&](const Vec2 &cell, int &x, int &y) -> bool {
+    auto dx = static_cast<int>(cell.x) - originX;
+    auto dy = static_cast<int>(cell.y) - originY;
+    if (cell.x < 0 || cell.y < 0 || dx < 0 || dy < 0) {
+      return false;
+    }
+    x = dx / ds;
+    y = dy / ds;
+    return x < width_ && y < height_;
+  };
+
+  const auto &grid = simulation.GetGrid();
+  const int left = std::max(originX, 0);
+  const int top = std::max(originY, 0);
+  const int right = std::min(originX + width_ * ds, kGridWidth);
+  const int bottom = std::min(originY + height_ * ds, kGridHeight);
+
+  for (int y = top; y < bottom; ++y) {
+    for (int x = left; x < right; ++x) {
+      auto plane = planeForCell(grid.GetCell(x, y));
+      if (plane) {
+        set(out.data(), *plane, (x - originX) / ds, (y - originY) / ds);
+      }
+    }
+  }
+
+  int x = 0;
+  int y = 0;
+  if (toOutput(pacmanCell, x, y)) {
+    set(out.data(), ObservationPlane::kPacman, x, y);
+  }
+
+  const auto &ghosts = simulation.GetGhosts();
+  for (std::size_t i = 0; i < kGhostCount; ++i) {
+    const auto &ghost = ghosts[i];
+    if (!toOutput(ghost.GetCell(), x, y)) {
+      continue;
+    }
+
+    set(out.data(), kGhostPlanes[i], x, y);
+
+    switch (ghost.GetStateType()) {
+    case GhostStateType::kScared:
+      set(out.data(), ObservationPlane::kScared, x, y);
+      break;
+    case GhostStateType::kRespawning:
+      set(out.data(), ObservationPlane::kRespawning, x, y);
+      break;
+    default:
+      break;
+    }
+  }
+}
+
+auto ObservationEncoder::set(std::uint8_t *out, ObservationPlane plane, int x, int y) const -> void {
+  auto *base = out + static_cast<std::size_t>(plane) * planeBytes_;
+  auto index = static_cast<std::size_t>(y) * static_cast<std::size_t>(width_) + static_cast<std::size_t>(x);
+
+  if (layout_.format == PlaneFormat::kBits) {
+    base[index / 8] |= static_cast<std::uint8_t>(1u << (index % 8));
+  } else {
+    base[index] = 1;
+  }
+}
@@ -0,0 +1,73 @@
+#ifndef OBSERVATION_ENCODER_H
+#define OBSERVATION_ENCODER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "simulation.h"
+
+/// Planes written by ObservationEncoder, in output order.
+enum class ObservationPlane : std::size_t {
+  kWalls,
+  kGate,
+  kPellets,
+  kPowerPellets,
+  kPacman,
+  kBlinky,
+  kInky,
+  kPinky,
+  kClyde,
+  kScared,     ///< Cells holding a ghost in GhostStateType::kScared
+  kRespawning, ///< Cells holding a ghost in GhostStateType::kRespawning
+  kCount,
+};
+
+enum class PlaneFormat {
+  kBytes, ///< One uint8 (0 or 1) per cell
+  kBits,  ///< One bit per cell, row-major, least significant bit first; each plane starts on a byte
+};
+
+/// Shape of an encoded observation.
+struct ObservationLayout {
+  PlaneFormat format{PlaneFormat::kBytes};
+  int downsample{1}; ///< Maze cells per output cell along each axis; an output cell is set if any of its cells is
+  int cropWidth{0};  ///< Output cells in a window centred on Pacman; 0 keeps the whole maze
+  int cropHeight{0}; ///< Output cells in a window centred on Pacman; 0 keeps the whole maze
+};
+
+/// Encodes a Simulation as fixed-shape planes over the grid, straight from the
+/// maze's Cell types and each ghost's GhostStateType. Writes into caller memory
+/// and allocates nothing, so it can fill a tensor in place.
+class ObservationEncoder {
+public:
+  /// Throws std::invalid_argument if downsample is below 1, a crop size is negative,
+  /// downsample or crop size * downsample exceeds kMaxWindowSpan, or Bytes() would
+  /// not fit in std::size_t.
+  explicit ObservationEncoder(const ObservationLayout &layout = {});
+
+  static constexpr std::size_t kPlanes = static_cast<std::size_t>(ObservationPlane::kCount);
+
+  /// Widest window, in maze cells, that a crop or downsample may cover along an axis.
+  static constexpr int kMaxWindowSpan = 1 << 16;
+
+  auto Width() const -> int { return width_; }
+  auto Height() const -> int { return height_; }
+  auto PlaneBytes() const -> std::size_t { return planeBytes_; }
+
+  /// Bytes of one encoded observation: kPlanes * PlaneBytes().
+  auto Bytes() const -> std::size_t { return kPlanes * planeBytes_; }
+
+  /// Writes the planes of `simulation` to `out`, which must hold Bytes() bytes.
+  auto Encode(const Simulation &simulation, std::span<std::uint8_t> out) const -> void;
+
+private:
+  auto set(std::uint8_t *out, ObservationPlane plane, int x, int y) const -> void;
+
+  ObservationLayout layout_;
+  int width_;
+  int height_;
+  std::size_t planeBytes_;
+};
+
+#endif
@@ -0,0 +1,136 @@
+#include <exception>
+#include <iostream>
+#include <limits>
+
+#include "default-maze.h"
+#include "pacman-env.h"
+#include "vector-env.h"
+
+static_assert(PACMAN_ENV_OBSERVATION_SIZE == VectorEnv::kObservationSize, "C header is out of date");
+static_assert(PACMAN_ENV_PLANE_COUNT == ObservationEncoder::kPlanes, "C header is out of date");
+static_assert(ObservationEncoder::kMaxWindowSpan == 65536, "C header is out of date");
+
+struct PacmanEnv {
+  VectorEnv env;
+};
+
+namespace {
+
+auto toLayout(const PacmanPlaneLayout &layout) -> ObservationLayout {
+  return {.format = layout.packed_bits != 0 ? PlaneFormat::kBits : PlaneFormat::kBytes,
+          .downsample = layout.downsample,
+          .cropWidth = layout.crop_width,
+          .cropHeight = layout.crop_height};
+}
+
+auto validLayout(const PacmanPlaneLayout *layout) -> bool {
+  return layout != nullptr && layout->downsample >= 1 && layout->crop_width >= 0 && layout->crop_height >= 0;
+}
+
+/// Runs `body` and reports any exception it throws, returning `failure` instead.
+template <typename Result, typename Body>
+auto guarded(const char *name, Result failure, Body &&body) noexcept -> Result {
+  try {
+    return body();
+  } catch (const std::exception &e) {
+    std::cerr << name << ": " << e.what() << std::endl;
+  } catch (...) {
+    std::cerr << name << ": unknown exception" << std::endl;
+  }
+  return failure;
+}
+
+} // namespace
+
+// Exceptions must not cross the C boundary: every entry point that can throw
+// runs inside guarded(), which reports the exception and returns an error.
+
+extern "C" PacmanEnv *env_create(int num_envs) { return env_create_ex(num_envs, 4, 0); }
+
+extern "C" PacmanEnv *env_create_ex(int num_envs, int frame_skip, int num_threads) {
+  if (num_envs < 1 || frame_skip < 1 || num_threads < 0) {
+    return nullptr;
+  }
+
+  return guarded("env_create", static_cast<PacmanEnv *>(nullptr), [&] {
+    return new PacmanEnv{VectorEnv{static_cast<std::size_t>(num_envs), Grid{kDefaultMaze}, frame_skip,
+                                   static_cast<std::size_t>(num_threads)}};
+  });
+}
+
+extern "C" void env_destroy(PacmanEnv *env) { delete env; }
+
+extern "C" int env_num_envs(const PacmanEnv *env) {
+  return env != nullptr ? static_cast<int>(env->env.Size()) : -1;
+}
+
+extern "C" int env_reset(PacmanEnv *env, const int32_t *ids, int count, float *obs_out) {
+  if (env == nullptr) {
+    return -1;
+  }
+
+  return guarded("env_reset", -1, [&] {
+    auto &vectorEnv = env->env;
+    if (ids == nullptr) {
+      for (std::size_t i = 0; i < vectorEnv.Size(); ++i) {
+        vectorEnv.Reset(i);
+      }
+    } else {
+      for (int i = 0; i < count; ++i) {
+        if (ids[i] < 0 || static_cast<std::size_t>(ids[i]) >= vectorEnv.Size()) {
+          return -1;
+        }
+      }
+      for (int i = 0; i < count; ++i) {
+        vectorEnv.Reset(static_cast<std::size_t>(ids[i]));
+      }
+    }
+
+    if (obs_out != nullptr) {
+      vectorEnv.Observe({obs_out, vectorEnv.Size() * VectorEnv::kObservationSize});
+    }
+    return 0;
+  });
+}
+
+extern "C" int env_step(PacmanEnv *env, const int32_t *actions, float *obs_out, float *reward_out,
+                        uint8_t *done_out) {
+  if (env == nullptr || actions == nullptr || obs_out == nullptr || reward_out == nullptr || done_out == nullptr) {
+    return -1;
+  }
+
+  return guarded("env_step", -1, [&] {
+    auto &vectorEnv = env->env;
+    auto size = vectorEnv.Size();
+    vectorEnv.Step({actions, size}, {obs_out, size * VectorEnv::kObservationSize}, {reward_out, size},
+                   {done_out, size});
+    return 0;
+  });
+}
+
+extern "C" int env_planes_size(const PacmanPlaneLayout *layout) {
+  if (!validLayout(layout)) {
+    return -1;
+  }
+
+  return guarded("env_planes_size", -1, [&] {
+    std::size_t bytes = ObservationEncoder{toLayout(*layout)}.Bytes();
+    return bytes <= static_cast<std::size_t>(std::numeric_limits<int>::max()) ? static_cast<int>(bytes) : -1;
+  });
+}
+
+extern "C" int env_observe_planes(const PacmanEnv *env, const PacmanPlaneLayout *layout, uint8_t *planes_out) {
+  if (env == nullptr || planes_out == nullptr || !validLayout(layout)) {
+    return -1;
+  }
+
+  return guarded("env_observe_planes", -1, [&] {
+    ObservationEncoder encoder{toLayout(*layout)};
+    auto games = env->env.Size();
+    if (encoder.Bytes() > std::numeric_limits<std::size_t>::max() / games) {
+      return -1;
+    }
+    env->env.ObservePlanes(encoder, {planes_out, games * encoder.Bytes()});
+    return 0;
+  });
+}
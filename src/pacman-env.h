@@ -0,0 +1,81 @@
+#ifndef PACMAN_ENV_H
+#define PACMAN_ENV_H
+
+/*
+ * C interface of libpacman_env, a batch of headless Pacman games for training
+ * agents from other languages. Every call steps all games at once and writes into
+ * buffers owned by the caller rather than allocating its own.
+ *
+ * Actions: 0 keep heading, 1 north, 2 south, 3 east, 4 west.
+ * Observations: PACMAN_ENV_OBSERVATION_SIZE floats per game, laid out as
+ * ObservationFeature in vector-env.h.
+ * Rewards: points scored during the step (kPelletPoints, kGhostPoints, ...).
+ * Done: 1 when the game lost its last life; the game restarts immediately.
+ *
+ * Functions returning int return 0 on success and -1 on invalid arguments.
+ */
+
+#include <stdint.h>
+
+#if defined(_WIN32)
+#define PACMAN_ENV_API __declspec(dllexport)
+#else
+#define PACMAN_ENV_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PACMAN_ENV_OBSERVATION_SIZE 22
+
+typedef struct PacmanEnv PacmanEnv;
+
+/* Functions returning int return 0 on success and -1 on invalid arguments or
+ * any internal error; no C++ exception escapes the library. */
+
+/* Creates `num_envs` games that repeat each action for 4 ticks and use every
+ * hardware thread. The maze is compiled into the library, so no asset files are
+ * needed. Returns NULL on failure. */
+PACMAN_ENV_API PacmanEnv *env_create(int num_envs);
+
+/* Like env_create with an explicit action repeat and thread count (0 = all cores). */
+PACMAN_ENV_API PacmanEnv *env_create_ex(int num_envs, int frame_skip, int num_threads);
+
+PACMAN_ENV_API void env_destroy(PacmanEnv *env);
+
+PACMAN_ENV_API int env_num_envs(const PacmanEnv *env);
+
+/* Starts new games in the `count` environments listed in `ids`, or in every
+ * environment when `ids` is NULL. Writes all observations to `obs_out` if it is
+ * not NULL. */
+PACMAN_ENV_API int env_reset(PacmanEnv *env, const int32_t *ids, int count, float *obs_out);
+
+/* Applies actions[i] to game i for frame_skip ticks. Each buffer holds one entry
+ * per game, obs_out PACMAN_ENV_OBSERVATION_SIZE per game. */
+PACMAN_ENV_API int env_step(PacmanEnv *env, const int32_t *actions, float *obs_out, float *reward_out,
+                            uint8_t *done_out);
+
+/* Plane observations (see ObservationPlane in observation-encoder.h): 11 planes
+ * over the 28x36 maze, optionally downsampled and/or cropped around Pacman. */
+#define PACMAN_ENV_PLANE_COUNT 11
+
+typedef struct PacmanPlaneLayout {
+  int packed_bits; /* 0: one uint8 per cell; 1: one bit per cell, each plane byte aligned */
+  int downsample;  /* maze cells per output cell along each axis (>= 1) */
+  int crop_width;  /* output cells in a window centred on Pacman; 0 keeps the whole maze */
+  int crop_height; /* downsample and crop * downsample must each be at most 65536 */
+} PacmanPlaneLayout;
+
+/* Bytes of one game's planes for `layout`, or -1 if the layout is invalid or
+ * the size does not fit in an int. */
+PACMAN_ENV_API int env_planes_size(const PacmanPlaneLayout *layout);
+
+/* Writes every game's planes back to back, env_planes_size bytes per game. */
+PACMAN_ENV_API int env_observe_planes(const PacmanEnv *env, const PacmanPlaneLayout *layout, uint8_t *planes_out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
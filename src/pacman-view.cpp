@@ -0,0 +1,31 @@
+#include <cmath>
+
+#include "pacman-view.h"
+
+auto headingForVelocity(const Vec2 &velocity) -> Direction;
+
+PacmanView::PacmanView(TextureCache &textures, const AnimationClock &clock, const Pacman &pacman)
+    : pacman_{pacman}, previous_{pacman.GetPosition()}, current_{pacman.GetPosition()},
+      sprite_{textures, Sprites::kPacman, clock, ForHeading(Clip::kPacmanNeutral, heading_), 16} {}
+
+void PacmanView::Update() {
+  auto heading = headingForVelocity(pacman_.GetVelocity());
+  if (heading != heading_) {
+    heading_ = heading;
+    sprite_.SetClip(ForHeading(Clip::kPacmanNeutral, heading_));
+  }
+}
+
+void PacmanView::Capture(float stepSeconds) {
+  previous_ = current_;
+  current_ = pacman_.GetPosition();
+  // Tunnel wraps and resets move further than any actor can travel in a step
+  teleported_ = previous_.Distance(current_) > kFastestActorSpeed * stepSeconds + kTeleportSlack;
+}
+
+void PacmanView::Render(SpriteBatch &batch, float alpha) {
+  // Teleports are drawn at the new position rather than swept across the maze
+  auto position = teleported_ ? current_ : Lerp(previous_, current_, alpha);
+  sprite_.Render(batch, RenderLayer::kActors, {.x = std::floor(position.x - kCellSize), .y = std::floor(position.y - kCellSize)});
+}
+
@@ -0,0 +1,37 @@
+#ifndef PACMAN_VIEW_H
+#define PACMAN_VIEW_H
+
+#include "animation.h"
+#include "constants.h"
+#include "pacman.h"
+#include "texture-cache.h"
+#include "sprite-batch.h"
+#include "sprite.h"
+
+/// Draws Pacman and animates the mouth for the direction of travel.
+class PacmanView {
+public:
+  PacmanView(TextureCache &textures, const AnimationClock &clock, const Pacman &pacman);
+
+  /// Switches clips if Pacman's direction of travel has changed.
+  void Update();
+
+  /// Records Pacman's position after a simulation step.
+  /// @param stepSeconds Length of the step just taken
+  void Capture(float stepSeconds);
+
+  /// Queues Pacman, between the last two captured positions, on the actors layer.
+  /// @param alpha Interpolation factor in [0, 1]
+  void Render(SpriteBatch &batch, float alpha);
+
+private:
+  const Pacman &pacman_;
+  Direction heading_{Direction::kNeutral};
+  Vec2 previous_;
+  Vec2 current_;
+  bool teleported_{false};
+
+  Sprite sprite_;
+};
+
+#endif
@@ -2,50 +2,45 @@
 #include <iostream>
 
 #include "constants.h"
+#include "ghost.h"
+#include "movement.h"
 #include "pacman.h"
 
-auto framesForHeading(const Direction &direction) -> std::vector<int>;
 auto velocityForHeading(const Direction &direction) -> Vec2;
 auto headingForVelocity(const Vec2 &velocity) -> Direction;
-auto center(float pos) -> float;
-auto boundUpper(float pos) -> float;
-auto boundLower(float pos) -> float;
-
-Pacman::Pacman(SDL_Renderer *renderer)
-    : position_{kPacmanHomePosition}, velocity_{.x = 0, .y = 0}, heading_{Direction::kNeutral} {
-  sprite_ = std::make_unique<Sprite>(renderer, Sprites::kPacman, 8, 16);
-  sprite_->SetFrames({1, 2});
-}
 
-auto Pacman::Update(const float deltaTime, Grid &grid, GameContext &context, AudioSystem &audio,
-                    std::vector<std::shared_ptr<Ghost>> &ghosts) -> void {
+Pacman::Pacman()
+    : position_{ToPosition(kPacmanHomePosition)}, velocity_{.x = 0, .y = 0}, heading_{Direction::kNeutral} {}
+
+auto Pacman::Update(const float deltaTime, Grid &grid, GameContext &context, SoundSink &audio,
+                    std::span<Ghost> ghosts) -> void {
 
   if (!isInTunnel()) {
-    // Updates velocity based on input if not in tunnel.
-    auto requestedPosition = NextCell(heading_);
-    if (grid.GetCell(requestedPosition) != Cell::kWall) {
-      sprite_->SetFrames(framesForHeading(heading_));
+    // Updates velocity based on input if not in tunnel. kNeutral stops Pacman.
+    if (heading_ == Direction::kNeutral || (grid.Exits(GetCell()) & MoveBit(heading_)) != 0) {
       velocity_ = velocityForHeading(heading_);
     }
   }
 
-  updatePosition(deltaTime);
+  // Ghosts hold still while Pacman moves, so he touches any ghost in the cell he
+  // leaves or the one he enters
+  const auto previousCell = GetCell();
+  updatePosition(StridesFor(context.level, context.tick, deltaTime)[Speed::kPacman]);
 
   auto currentHeading = headingForVelocity(velocity_);
-  auto nextPosition = NextCell(currentHeading);
-  if (grid.GetCell(nextPosition) == Cell::kWall) {
+  if ((grid.Exits(GetCell()) & MoveBit(currentHeading)) == 0) {
     switch (currentHeading) {
     case Direction::kEast:
-      position_.x = boundUpper(position_.x);
+      position_.x = BoundUpper(position_.x);
       break;
     case Direction::kWest:
-      position_.x = boundLower(position_.x);
+      position_.x = BoundLower(position_.x);
       break;
     case Direction::kNorth:
-      position_.y = boundLower(position_.y);
+      position_.y = BoundLower(position_.y);
       break;
     case Direction::kSouth:
-      position_.y = boundUpper(position_.y);
+      position_.y = BoundUpper(position_.y);
       break;
     default:
       break;
@@ -58,33 +53,32 @@ auto Pacman::Update(const float deltaTime, Grid &grid, GameContext &context, Aud
   }
 
   if (IsEnergized()) {
-    auto currentPosition = GetCell();
+    auto currentCell = GetCell();
     for (auto &ghost : ghosts) {
-      if (currentPosition == ghost->GetCell() && !ghost->IsRespawning()) {
+      auto ghostCell = ghost.GetCell();
+      if ((ghostCell == currentCell || ghostCell == previousCell) && !ghost.IsRespawning()) {
         context.score += kGhostPoints;
-        [[maybe_unused]] auto [handle, future] = audio.PlaySound(Sounds::kPowerPellet, 5);
-        ghost->TransitionTo(GhostStateType::kRespawning);
+        audio.Play(Sounds::kPowerPellet, 5);
+        ghost.TransitionTo(GhostStateType::kRespawning);
       }
     }
   }
 
-  if (grid.HasPellet(GetCell())) {
-    // handle energizer
-    auto pellet = grid.ConsumePellet(GetCell());
-    if (pellet->IsEnergizer()) {
+  // eat the pellet under Pacman, if any
+  auto pellet = grid.ConsumePellet(GetCell());
+  if (pellet != Cell::kBlank) {
+    if (pellet == Cell::kPowerPellet) {
       context.score += kEnergizerPoints;
       energizedFor_ = kEnergizerDuration;
       //      state.mode = GhostMode::kScared;
-      [[maybe_unused]] auto [handle, future] = audio.PlaySound(Sounds::kPowerPellet, 5);
+      audio.Play(Sounds::kPowerPellet, 5);
     } else {
       context.score += kPelletPoints;
-      [[maybe_unused]] auto [handle, future] = audio.PlaySound(Sounds::kMunch1, std::nullopt);
+      audio.Play(Sounds::kMunch1, std::nullopt);
     }
 
     context.pelletsConsumed += 1;
   }
-
-  sprite_->Update(deltaTime);
 }
 
 auto Pacman::isInTunnel() -> bool {
@@ -98,29 +92,29 @@ auto Pacman::isInTunnel() -> bool {
 }
 
 /**
- * Updates the position of Pacman given time change
+ * Moves Pacman along his velocity
  *
- * @param timeDelta
+ * @param stride distance to move this update
  */
-auto Pacman::updatePosition(float timeDelta) -> void {
-  position_ += (velocity_ * timeDelta);
+auto Pacman::updatePosition(Coord stride) -> void {
+  position_ = Advance(position_, velocity_, stride);
 
   //  teleport on side
-  if (position_.x < -16) {
-    position_.x = kGridWidth * kCellSize + 16;
-  } else if (position_.x > kGridWidth * kCellSize + 16) {
-    position_.x = -16;
+  if (position_.x < FromPixels(-16)) {
+    position_.x = FromPixels(kGridWidth * kCellSize + 16);
+  } else if (position_.x > FromPixels(kGridWidth * kCellSize + 16)) {
+    position_.x = FromPixels(-16);
   }
 
   // Ensures Pacman is centered in Grid
   switch (headingForVelocity(velocity_)) {
   case Direction::kEast:
   case Direction::kWest:
-    position_.y = center(position_.y);
+    position_.y = CellCenter(position_.y);
     break;
   case Direction::kNorth:
   case Direction::kSouth:
-    position_.x = center(position_.x);
+    position_.x = CellCenter(position_.x);
     break;
   default:
     break;
@@ -129,27 +123,22 @@ auto Pacman::updatePosition(float timeDelta) -> void {
 
 auto Pacman::Reset() -> void {
   velocity_ = Vec2{.x = 0, .y = 0};
-  position_ = kPacmanHomePosition;
+  position_ = ToPosition(kPacmanHomePosition);
   heading_ = Direction::kNeutral;
 }
 
-auto Pacman::Render(SDL_Renderer *renderer) -> void {
-  sprite_->Render(renderer, {.x = floor(position_.x - kCellSize), .y = floor(position_.y - kCellSize)});
-}
-
-auto Pacman::ProcessInput(const Uint8 *state) -> void {
-  if (state[SDL_SCANCODE_RIGHT]) {
-    heading_ = Direction::kEast;
-  } else if (state[SDL_SCANCODE_LEFT]) {
-    heading_ = Direction::kWest;
-  } else if (state[SDL_SCANCODE_UP]) {
-    heading_ = Direction::kNorth;
-  } else if (state[SDL_SCANCODE_DOWN]) {
-    heading_ = Direction::kSouth;
+/**
+ * ProcessInput records the heading requested by the player. Pacman turns
+ * once the next cell in that direction is open.
+ * @param requested requested heading; kNeutral keeps the current request.
+ */
+auto Pacman::ProcessInput(Direction requested) -> void {
+  if (requested != Direction::kNeutral) {
+    heading_ = requested;
   }
 }
 
-auto Pacman::GetPosition() const -> Vec2 { return position_; }
+auto Pacman::GetPosition() const -> Vec2 { return ToVec2(position_); }
 
 /**
  * GetHeading return Pacman's current heading
@@ -161,7 +150,7 @@ auto Pacman::GetHeading() const -> Direction { return heading_; }
  * GetCell returns the current cell occupied by Pacman.
  * @return current cell (Vec2)
  */
-auto Pacman::GetCell() const -> Vec2 { return (position_ / kCellSize).Floor(); }
+auto Pacman::GetCell() const -> Vec2 { return CellOf(position_); }
 
 /**
  * NextCell determines next cell that Pacman will occupy
@@ -190,30 +179,21 @@ auto Pacman::NextCell(const Direction &direction) const -> Vec2 {
   }
 }
 
+auto Pacman::Snapshot() const -> PacmanSnapshot {
+  return {.position = ToVec2(position_), .velocity = velocity_, .heading = heading_, .energizedFor = energizedFor_};
+}
+
+auto Pacman::Restore(const PacmanSnapshot &snapshot) -> void {
+  position_ = ToPosition(snapshot.position);
+  velocity_ = snapshot.velocity;
+  heading_ = snapshot.heading;
+  energizedFor_ = snapshot.energizedFor;
+}
+
 auto Pacman::Pause() -> void {}
 
 auto Pacman::Resume() -> void {}
 
-/**
- * Determines the sequence of frames to animate for movement in given heading.
- * @param direction direction pacman is moving
- * @return sequence of frames to animate
- */
-auto framesForHeading(const Direction &direction) -> std::vector<int> {
-  switch (direction) {
-  case Direction::kEast:
-    return {1, 2};
-  case Direction::kWest:
-    return {3, 4};
-  case Direction::kNorth:
-    return {5, 6};
-  case Direction::kSouth:
-    return {7, 8};
-  case Direction::kNeutral:
-    return {1, 2};
-  }
-}
-
 /**
  * Computes the velocity Vector for the given heading
  * @param direction direction pacman is moving
@@ -247,15 +227,3 @@ auto headingForVelocity(const Vec2 &velocity) -> Direction {
     return Direction::kNeutral;
   }
 }
-
-auto center(float pos) -> float { return floor(((int)pos / kCellSize) * kCellSize + (kCellSize / 2)); }
-
-auto boundUpper(float pos) -> float {
-  auto max = center(pos);
-  return pos > max ? max : pos;
-}
-
-auto boundLower(float pos) -> float {
-  auto min = center(pos);
-  return pos < min ? min : pos;
-}
@@ -1,49 +1,57 @@
 #ifndef PACMAN_H
 #define PACMAN_H
 
-#include <string>
-#include <vector>
+#include <span>
 
-#include "SDL.h"
-
-#include "audio-system.h"
 #include "constants.h"
 #include "game-context.h"
-#include "ghost.h"
 #include "grid.h"
-#include "sprite.h"
+#include "movement.h"
+#include "sound-sink.h"
 #include "vector2.h"
 
 class Ghost;
 
+/// Plain-data copy of Pacman state.
+struct PacmanSnapshot {
+  Vec2 position;
+  Vec2 velocity;
+  Direction heading;
+  float energizedFor;
+
+  auto operator==(const PacmanSnapshot &) const -> bool = default;
+};
+
 class Pacman {
 public:
-  Pacman(SDL_Renderer *renderer);
+  Pacman();
 
-  auto Update(const float deltaTime, Grid &grid, GameContext &context, AudioSystem &audio,
-              std::vector<std::shared_ptr<Ghost>> &ghosts) -> void;
-  auto Render(SDL_Renderer *renderer) -> void;
-  auto ProcessInput(const Uint8 *state) -> void;
+  auto Update(const float deltaTime, Grid &grid, GameContext &context, SoundSink &audio,
+              std::span<Ghost> ghosts) -> void;
+  auto ProcessInput(Direction requested) -> void;
 
   auto GetPosition() const -> Vec2;
+  auto GetVelocity() const -> Vec2 { return velocity_; }
   auto GetHeading() const -> Direction;
   auto GetCell() const -> Vec2;
   auto NextCell(const Direction &direction) const -> Vec2;
   auto Reset() -> void;
   auto IsEnergized() const -> bool { return energizedFor_ > 0.0; };
+  auto GetEnergizedFor() const -> float { return energizedFor_; }
   auto Pause() -> void;
   auto Resume() -> void;
 
+  auto Snapshot() const -> PacmanSnapshot;
+  auto Restore(const PacmanSnapshot &snapshot) -> void;
+
 private:
-  auto updatePosition(float timeDelta) -> void;
+  auto updatePosition(Coord stride) -> void;
   auto isInTunnel() -> bool;
 
-  Vec2 position_;
+  Position position_;
   Vec2 velocity_;
   Direction heading_;
   float energizedFor_ = 0.0;
-
-  std::unique_ptr<Sprite> sprite_;
 };
 
 #endif
\ No newline at end of file
@@ -1,18 +1,27 @@
+#include "constants.h"
 #include "pellet.h"
 
-Pellet::Pellet(SDL_Renderer *renderer, const Vec2 position) : Pellet(renderer, position, false) {}
+PelletLayer::PelletLayer(TextureCache &textures, const AnimationClock &clock)
+    : pellet_{textures, Sprites::kPellet},
+      powerPellet_{textures, Sprites::kPowerPellet, clock, Clip::kPowerPelletBlink, 8} {}
 
-Pellet::Pellet(SDL_Renderer *renderer, const Vec2 position, bool power) : position{position}, power{power} {
-  if (power) {
-    sprite = std::make_unique<Sprite>(renderer, Sprites::kPowerPellet, 3, 8);
-    sprite->SetFrames({1, 2});
-  } else {
-    sprite = std::make_unique<Sprite>(renderer, Sprites::kPellet);
-  }
-}
+auto PelletLayer::Reset() -> void { powerPellet_.Rewind(); }
 
-auto Pellet::Update(const float deltaTime) -> void { sprite->Update(deltaTime); }
+auto PelletLayer::Render(SpriteBatch &batch, const Grid &grid) -> void {
+  renderBoard(batch, grid.RegularPellets(), pellet_);
+  renderBoard(batch, grid.PowerPellets(), powerPellet_);
+}
 
-auto Pellet::Render(SDL_Renderer *renderer) -> void { sprite->Render(renderer, {position.x * 8, position.y * 8}); }
+auto PelletLayer::renderBoard(SpriteBatch &batch, const CellBoard &board, Sprite &sprite) -> void {
+  auto remaining = board.count();
+  for (int index = 0; remaining > 0; ++index) {
+    if (!board.test(index)) {
+      continue;
+    }
+    remaining--;
 
-auto Pellet::IsEnergizer() const -> bool { return power; }
+    auto x = static_cast<float>(index % kGridWidth);
+    auto y = static_cast<float>(index / kGridWidth);
+    sprite.Render(batch, RenderLayer::kPellets, {x * kCellSize, y * kCellSize});
+  }
+}
@@ -1,29 +1,35 @@
 #ifndef PELLET_H
 #define PELLET_H
 
-#include <memory>
-#include <string>
-#include <vector>
-
-#include "SDL.h"
-
+#include "animation.h"
+#include "grid.h"
+#include "texture-cache.h"
+#include "sprite-batch.h"
 #include "sprite.h"
-#include "vector2.h"
 
-class Pellet {
+/// Draws the pellets still present on a Grid. The grid owns pellet occupancy as
+/// bitboards; this layer holds one sprite per pellet kind, and the power pellets
+/// all show the one blink clip.
+///
+/// Every pellet is queued on the pellets layer of the frame's SpriteBatch, so the
+/// whole layer is one draw call however many pellets remain, and eating a pellet
+/// or starting a level touches no textures.
+class PelletLayer {
 public:
-  Pellet(SDL_Renderer *renderer, const Vec2 position);
-  Pellet(SDL_Renderer *renderer, const Vec2 position, bool power);
+  /// @param clock Clock the power pellets blink on
+  PelletLayer(TextureCache &textures, const AnimationClock &clock);
 
-  void Update(const float deltaTime);
-  void Render(SDL_Renderer *renderer);
+  /// Queues a pellet on every occupied cell of `grid`.
+  void Render(SpriteBatch &batch, const Grid &grid);
 
-  bool IsEnergizer() const;
+  /// Restarts the blink (e.g. at level start).
+  void Reset();
 
 private:
-  Vec2 position;
-  std::unique_ptr<Sprite> sprite;
-  bool power;
+  void renderBoard(SpriteBatch &batch, const CellBoard &board, Sprite &sprite);
+
+  Sprite pellet_;
+  Sprite powerPellet_;
 };
 
 #endif
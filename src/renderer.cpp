@@ -15,11 +15,13 @@ Renderer::Renderer(const std::size_t screen_width, const std::size_t screen_heig
   }
 
   // Create renderer
-  sdl_renderer = SDL_CreateRenderer(sdl_window, -1, SDL_RENDERER_ACCELERATED);
+  sdl_renderer = SDL_CreateRenderer(sdl_window, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
   if (nullptr == sdl_renderer) {
     std::cerr << "Renderer could not be created.\n";
     std::cerr << "SDL_Error: " << SDL_GetError() << "\n";
   }
+
+  textures_ = std::make_unique<TextureCache>(sdl_renderer);
 }
 
 Renderer::~Renderer() { SDL_DestroyWindow(sdl_window); }
@@ -28,7 +30,11 @@ void Renderer::SetWindowSize(int width, int height) { SDL_SetWindowSize(sdl_wind
 
 auto Renderer::Clear() -> void { SDL_RenderClear(sdl_renderer); }
 
-auto Renderer::Present() -> void { SDL_RenderPresent(sdl_renderer); }
+auto Renderer::Present() -> void {
+  lastFrame_ = batch_.Flush(sdl_renderer);
+  totals_ += lastFrame_;
+  SDL_RenderPresent(sdl_renderer);
+}
 
 auto Renderer::CreateTextureFromSurface(SDL_Surface *surface) -> SDL_Texture * {
   return SDL_CreateTextureFromSurface(sdl_renderer, surface);
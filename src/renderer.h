@@ -2,7 +2,10 @@
 #define RENDERER_H
 
 #include "SDL.h"
+#include "sprite-batch.h"
 #include "sprite.h"
+#include "texture-cache.h"
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -14,8 +17,22 @@ public:
   void SetWindowSize(int width, int height);
 
   void Clear();
+
+  /// Draws the sprites queued on Batch() this frame, then shows the frame.
   void Present();
 
+  /// Sprite textures of this renderer, shared by every Sprite drawn with it.
+  auto Textures() -> TextureCache & { return *textures_; }
+
+  /// Collects the sprites of the current frame.
+  auto Batch() -> SpriteBatch & { return batch_; }
+
+  /// Draw calls and sprites of the last presented frame.
+  auto LastFrame() const -> const FrameStats & { return lastFrame_; }
+
+  /// Draw calls and sprites summed over every presented frame.
+  auto Totals() const -> const FrameStats & { return totals_; }
+
   SDL_Texture *CreateTextureFromSurface(SDL_Surface *surface);
 
   SDL_Renderer *sdl_renderer;
@@ -25,6 +42,10 @@ public:
 private:
   SDL_Window *sdl_window;
   // SDL_Renderer *sdl_renderer;
+  std::unique_ptr<TextureCache> textures_;
+  SpriteBatch batch_;
+  FrameStats lastFrame_{};
+  FrameStats totals_{};
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,171 @@
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+#include "replay.h"
+
+namespace {
+
+constexpr std::uint8_t kHeadingMask = 0x07;
+constexpr std::uint8_t kPauseBit = 0x08;
+
+} // namespace
+
+auto TickInput::Encode() const -> std::uint8_t {
+  auto bits = static_cast<std::uint8_t>(static_cast<std::uint8_t>(heading) & kHeadingMask);
+  return pause ? static_cast<std::uint8_t>(bits | kPauseBit) : bits;
+}
+
+auto TickInput::Decode(std::uint8_t bits) -> TickInput {
+  auto heading = static_cast<std::uint8_t>(bits & kHeadingMask);
+  if (heading > static_cast<std::uint8_t>(Direction::kWest)) {
+    heading = static_cast<std::uint8_t>(Direction::kNeutral);
+  }
+  return {static_cast<Direction>(heading), (bits & kPauseBit) != 0};
+}
+
+ReplayRecorder::ReplayRecorder(std::uint32_t tickRate, std::uint64_t seed, std::uint32_t keyframeInterval)
+    : tickRate_{tickRate}, seed_{seed}, keyframeInterval_{keyframeInterval} {
+  if (keyframeInterval_ == 0) {
+    throw std::invalid_argument("keyframe interval must be positive");
+  }
+}
+
+auto ReplayRecorder::Append(TickInput input, const Simulation &simulation) -> void {
+  auto bits = input.Encode();
+
+  if (runs_.empty() || runs_.back().input != bits || runs_.back().length == kMaxRunLength) {
+    if (!runs_.empty()) {
+      runStartTick_ = tickCount_;
+    }
+    runs_.push_back({.input = bits, .reserved = 0, .length = 0});
+  }
+  runs_.back().length += 1;
+
+  if (tickCount_ % keyframeInterval_ == 0) {
+    ReplayKeyframe keyframe{};
+    keyframe.tick = tickCount_;
+    keyframe.runStartTick = runStartTick_;
+    keyframe.runIndex = static_cast<std::uint32_t>(runs_.size() - 1);
+    keyframe.snapshot = simulation.Snapshot();
+    keyframes_.push_back(keyframe);
+  }
+
+  tickCount_ += 1;
+}
+
+auto ReplayRecorder::Save(const std::string &path) const -> void {
+  ReplayHeader header{};
+  header.magic = kReplayMagic;
+  header.version = kReplayVersion;
+  header.tickRate = tickRate_;
+  header.seed = seed_;
+  header.tickCount = tickCount_;
+  header.keyframeInterval = keyframeInterval_;
+  header.keyframeCount = static_cast<std::uint32_t>(keyframes_.size());
+  header.runCount = static_cast<std::uint32_t>(runs_.size());
+  header.snapshotSize = sizeof(SimulationSnapshot);
+  header.keyframesOffset = sizeof(ReplayHeader);
+  header.runsOffset = header.keyframesOffset + keyframes_.size() * sizeof(ReplayKeyframe);
+
+  std::ofstream file{path, std::ios::binary | std::ios::trunc};
+  if (!file.is_open()) {
+    throw std::runtime_error("Unable to write replay: " + path);
+  }
+
+  file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+  file.write(reinterpret_cast<const char *>(keyframes_.data()),
+             static_cast<std::streamsize>(keyframes_.size() * sizeof(ReplayKeyframe)));
+  file.write(reinterpret_cast<const char *>(runs_.data()),
+             static_cast<std::streamsize>(runs_.size() * sizeof(InputRun)));
+
+  if (!file) {
+    throw std::runtime_error("Unable to write replay: " + path);
+  }
+}
+
+ReplayReader::ReplayReader(const std::string &path) : file_{path} {
+  if (file_.Size() < sizeof(ReplayHeader)) {
+    throw std::runtime_error("Not a replay file: " + path);
+  }
+  std::memcpy(&header_, file_.Data(), sizeof(header_));
+
+  if (header_.magic != kReplayMagic) {
+    throw std::runtime_error("Not a replay file: " + path);
+  }
+  if (header_.version != kReplayVersion || header_.snapshotSize != sizeof(SimulationSnapshot)) {
+    throw std::runtime_error("Replay was recorded by an incompatible build: " + path);
+  }
+
+  auto keyframesEnd = header_.keyframesOffset + std::uint64_t{header_.keyframeCount} * sizeof(ReplayKeyframe);
+  auto runsEnd = header_.runsOffset + std::uint64_t{header_.runCount} * sizeof(InputRun);
+  if (keyframesEnd > file_.Size() || runsEnd > file_.Size() || header_.keyframesOffset % alignof(ReplayKeyframe) != 0 ||
+      header_.runsOffset % alignof(InputRun) != 0 || header_.keyframesOffset > file_.Size() ||
+      header_.runsOffset > file_.Size() || header_.tickRate == 0 || header_.keyframeInterval == 0) {
+    throw std::runtime_error("Replay file is truncated or corrupt: " + path);
+  }
+
+  // mmap and the fallback buffer are both suitably aligned for the offsets checked above
+  keyframes_ = {reinterpret_cast<const ReplayKeyframe *>(file_.Data() + header_.keyframesOffset),
+                header_.keyframeCount};
+  runs_ = {reinterpret_cast<const InputRun *>(file_.Data() + header_.runsOffset), header_.runCount};
+
+  // InputAt jumps straight to a keyframe's run, so each one must point inside the
+  // runs at the run holding its tick, and keyframes must be in tick order
+  const ReplayKeyframe *previous = nullptr;
+  for (const auto &keyframe : keyframes_) {
+    auto valid = keyframe.runIndex < runs_.size() && keyframe.tick < header_.tickCount &&
+                 keyframe.runStartTick <= keyframe.tick &&
+                 keyframe.tick - keyframe.runStartTick < runs_[keyframe.runIndex].length;
+    if (valid && previous != nullptr) {
+      valid = keyframe.tick > previous->tick && keyframe.runIndex >= previous->runIndex &&
+              keyframe.runStartTick >= previous->runStartTick;
+    }
+    if (!valid) {
+      throw std::runtime_error("Replay file is truncated or corrupt: " + path);
+    }
+    previous = &keyframe;
+  }
+}
+
+auto ReplayReader::InputAt(std::uint64_t tick) const -> TickInput {
+  if (tick >= header_.tickCount || runs_.empty()) {
+    return {};
+  }
+
+  // Rewind when the cursor is past the tick, and jump to the nearest keyframe when
+  // it is at least one keyframe interval behind
+  if (tick < cursorStart_) {
+    cursorRun_ = 0;
+    cursorStart_ = 0;
+  }
+  if (tick - cursorStart_ >= header_.keyframeInterval) {
+    const auto *keyframe = KeyframeBefore(tick);
+    if (keyframe != nullptr && keyframe->runStartTick > cursorStart_) {
+      cursorRun_ = keyframe->runIndex;
+      cursorStart_ = keyframe->runStartTick;
+    }
+  }
+
+  while (cursorRun_ + 1 < runs_.size() && tick >= cursorStart_ + runs_[cursorRun_].length) {
+    cursorStart_ += runs_[cursorRun_].length;
+    cursorRun_ += 1;
+  }
+
+  return TickInput::Decode(runs_[cursorRun_].input);
+}
+
+auto ReplayReader::KeyframeBefore(std::uint64_t tick) const -> const ReplayKeyframe * {
+  auto it = std::upper_bound(keyframes_.begin(), keyframes_.end(), tick,
+                             [](std::uint64_t value, const ReplayKeyframe &keyframe) { return value < keyframe.tick; });
+  if (it == keyframes_.begin()) {
+    return nullptr;
+  }
+  return &*std::prev(it);
+}
+
+auto ReplayReader::KeyframeAt(std::uint64_t tick) const -> const ReplayKeyframe * {
+  const auto *keyframe = KeyframeBefore(tick);
+  return (keyframe != nullptr && keyframe->tick == tick) ? keyframe : nullptr;
+}
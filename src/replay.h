@@ -0,0 +1,149 @@
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "mapped-file.h"
+#include "movement.h"
+#include "simulation.h"
+
+/// Player input applied during one fixed simulation tick.
+struct TickInput {
+  Direction heading{Direction::kNeutral};
+  bool pause{false};
+
+  /// Packs the input into one byte: heading in bits 0-2, pause in bit 3.
+  auto Encode() const -> std::uint8_t;
+  static auto Decode(std::uint8_t bits) -> TickInput;
+
+  auto operator==(const TickInput &) const -> bool = default;
+};
+
+/*
+ * Replay file layout. All fields are in host byte order, and snapshots are stored
+ * as raw SimulationSnapshot bytes, so a replay is only valid on builds that agree
+ * on kReplayVersion and sizeof(SimulationSnapshot); the header records both.
+ *
+ *   ReplayHeader
+ *   ReplayKeyframe[keyframeCount]   sorted by tick, at keyframesOffset
+ *   InputRun[runCount]              run-length encoded inputs, at runsOffset
+ *
+ * Every section is naturally aligned, so a mapped file is read in place.
+ */
+
+inline constexpr std::array<char, 8> kReplayMagic{'P', 'A', 'C', 'R', 'E', 'P', 'L', 'Y'};
+
+/// Set in kReplayVersion by fixed-point builds (PACMAN_FIXED_POINT). Their games
+/// play out differently, so each kind of build rejects the other's replays.
+inline constexpr std::uint32_t kReplayFixedPointFlag = 1u << 31;
+inline constexpr std::uint32_t kReplayVersion = 3u | (kFixedPointMovement ? kReplayFixedPointFlag : 0u);
+
+struct ReplayHeader {
+  std::array<char, 8> magic;
+  std::uint32_t version;
+  std::uint32_t tickRate;
+  std::uint64_t seed;
+  std::uint64_t tickCount;
+  std::uint32_t keyframeInterval;
+  std::uint32_t keyframeCount;
+  std::uint32_t runCount;
+  std::uint32_t snapshotSize;
+  std::uint64_t keyframesOffset;
+  std::uint64_t runsOffset;
+};
+
+/// `length` consecutive ticks that share the same encoded input.
+struct InputRun {
+  std::uint8_t input;
+  std::uint8_t reserved;
+  std::uint16_t length;
+};
+
+/// World state captured before `tick` was applied, plus the run holding that tick
+/// so playback can resume from the keyframe without scanning earlier runs.
+struct ReplayKeyframe {
+  std::uint64_t tick;
+  std::uint64_t runStartTick;
+  std::uint32_t runIndex;
+  std::uint32_t reserved;
+  SimulationSnapshot snapshot;
+};
+
+static_assert(std::is_trivially_copyable_v<ReplayHeader> && std::is_trivially_copyable_v<ReplayKeyframe>);
+static_assert(sizeof(ReplayHeader) % alignof(ReplayKeyframe) == 0, "keyframes follow the header");
+static_assert(sizeof(ReplayKeyframe) % alignof(InputRun) == 0, "runs follow the keyframes");
+
+/// Accumulates one input per tick and periodic keyframes, then writes a replay file.
+class ReplayRecorder {
+public:
+  /// @param tickRate Simulation steps per second of the recorded session
+  /// @param seed Seed of any randomness the driver used, stored for playback
+  /// @param keyframeInterval Ticks between keyframes; throws std::invalid_argument if 0
+  ReplayRecorder(std::uint32_t tickRate, std::uint64_t seed, std::uint32_t keyframeInterval);
+
+  /// Records the input for the next tick. Call before the tick is applied so that
+  /// keyframes hold the state the input acts on.
+  auto Append(TickInput input, const Simulation &simulation) -> void;
+
+  auto TickCount() const -> std::uint64_t { return tickCount_; }
+
+  /// Writes the replay. Throws std::runtime_error if the file cannot be written.
+  auto Save(const std::string &path) const -> void;
+
+private:
+  static constexpr std::uint16_t kMaxRunLength = UINT16_MAX;
+
+  std::uint32_t tickRate_;
+  std::uint64_t seed_;
+  std::uint32_t keyframeInterval_;
+  std::uint64_t tickCount_{0};
+  std::uint64_t runStartTick_{0};
+  std::vector<InputRun> runs_;
+  std::vector<ReplayKeyframe> keyframes_;
+};
+
+/// Read-only view of a replay file. The file is mapped rather than parsed, so
+/// opening only checks the header and keyframe index, and any tick can be looked
+/// up without decoding the runs before its nearest keyframe.
+///
+/// InputAt moves a shared lookup cursor, so a reader must not be used from more
+/// than one thread at a time; open a reader per thread instead.
+class ReplayReader {
+public:
+  /// Opens `path`. Throws std::runtime_error if it is not a replay this build can
+  /// play, or if its header or any keyframe is inconsistent with the input runs.
+  explicit ReplayReader(const std::string &path);
+
+  auto TickRate() const -> std::uint32_t { return header_.tickRate; }
+  auto Seed() const -> std::uint64_t { return header_.seed; }
+  auto TickCount() const -> std::uint64_t { return header_.tickCount; }
+  auto Keyframes() const -> std::span<const ReplayKeyframe> { return keyframes_; }
+
+  /// Returns the input recorded for `tick`. Sequential lookups are amortised O(1).
+  /// Not thread-safe: updates the reader's lookup cursor.
+  auto InputAt(std::uint64_t tick) const -> TickInput;
+
+  /// Returns the last keyframe at or before `tick`, if any.
+  auto KeyframeBefore(std::uint64_t tick) const -> const ReplayKeyframe *;
+
+  /// Returns the keyframe taken exactly at `tick`, if there is one.
+  auto KeyframeAt(std::uint64_t tick) const -> const ReplayKeyframe *;
+
+private:
+  MappedFile file_;
+  ReplayHeader header_{};
+  std::span<const ReplayKeyframe> keyframes_;
+  std::span<const InputRun> runs_;
+
+  // Cursor of the last lookup, so playback does not search for every tick
+  mutable std::size_t cursorRun_{0};
+  mutable std::uint64_t cursorStart_{0};
+};
+
+#endif
@@ -0,0 +1,237 @@
+#include <algorithm>
+
+#include "default-maze.h"
+#include "simulation.h"
+
+namespace {
+
+// Steps this close to a whole number of ticks, as a fraction of a tick, count as
+// whole ticks; absorbs the rounding in e.g. 4 * kTickSeconds
+constexpr float kTickTolerance = 1e-3f;
+
+/// How Step divides a step: `ticks` sub-steps of kTickSeconds, then one of
+/// `remainder` seconds if `substeps` is one more than `ticks`. Fixed-point builds
+/// run whole ticks only and hand the time left over back as `carry`.
+struct StepPlan {
+  int ticks;
+  int substeps;
+  float remainder;
+  float carry;
+};
+
+/**
+ * Splits a step at reference tick boundaries rather than into equal parts, so
+ * the sub-steps of a coarse step are the very ticks a 60 Hz driver would run and
+ * both reach the same cell-centre crossings in the same order. A tick moves no
+ * actor more than kMaxSubstepDistance (see constants.h).
+ */
+auto planStep(float deltaTime) -> StepPlan {
+  const auto ticks = static_cast<int>(deltaTime / kTickSeconds + kTickTolerance);
+  const auto remainder = deltaTime - static_cast<float>(ticks) * kTickSeconds;
+  if constexpr (kFixedPointMovement) {
+    // Speed patterns advance a tick at a time, so a partial tick waits for the next step
+    return {ticks, ticks, 0.0f, std::max(remainder, 0.0f)};
+  }
+
+  if (ticks == 0) {
+    return {0, 1, deltaTime, 0.0f}; // shorter than a tick: one sub-step
+  }
+  if (remainder > kTickTolerance * kTickSeconds) {
+    return {ticks, ticks + 1, remainder, 0.0f};
+  }
+  return {ticks, ticks, 0.0f, 0.0f};
+}
+
+} // namespace
+
+Simulation::Simulation(SoundSink &sound) : Simulation{sound, Grid{kDefaultMaze}} {}
+
+Simulation::Simulation(SoundSink &sound, const std::vector<std::vector<Cell>> &cells) : sound_{sound}, grid_{cells} {
+  activateGhosts();
+}
+
+Simulation::Simulation(SoundSink &sound, const Grid &grid) : sound_{sound}, grid_{grid} { activateGhosts(); }
+
+auto Simulation::activateGhosts() -> void {
+  blinky().Activate();
+  ghosts_[2].Activate(); // Pinky
+}
+
+auto Simulation::ProcessInput(Direction requested) -> void { pacman_.ProcessInput(requested); }
+
+/**
+ * Chooses a heading for every ghost that reaches an intersection on its next
+ * update in one batched SteerTowards call. Every ghost plans from the world as
+ * Pacman left it, before any ghost moves, so Inky aims off Blinky's cell at the
+ * start of the step. Ghosts with no choice to make get kNeutral.
+ */
+auto Simulation::steerGhosts() -> std::array<Direction, kGhostCount> {
+  for (std::size_t i = 0; i < ghosts_.size(); ++i) {
+    steering_.Set(i, ghosts_[i].PlanSteering(grid_, pacman_, blinky()));
+  }
+
+  std::array<Direction, kGhostCount> headings{};
+  SteerTowards(steering_, headings);
+  return headings;
+}
+
+auto Simulation::Step(float deltaTime) -> SimulationStatus {
+  const auto plan = planStep(context_.tickCarry + deltaTime);
+  context_.tickCarry = plan.carry;
+  for (int i = 0; i < plan.substeps; ++i) {
+    auto status = substep(i < plan.ticks ? kTickSeconds : plan.remainder);
+    if (status != SimulationStatus::kRunning) {
+      return status;
+    }
+  }
+  return SimulationStatus::kRunning;
+}
+
+auto Simulation::Substeps(float deltaTime) -> int { return planStep(deltaTime).substeps; }
+
+/**
+ * Advances the world by one sub-step and sweeps each ghost's move for contact
+ * with Pacman. Pacman moves first, against ghosts that hold still (Pacman::Update
+ * checks both cells of his move), then each ghost moves against Pacman's new
+ * cell: a ghost that can kill is caught in either the cell it left or the one it
+ * entered. Checking only where the ghosts end up would let a ghost and Pacman
+ * that swap cells pass through each other.
+ */
+auto Simulation::substep(float deltaTime) -> SimulationStatus {
+  waveManager_.Update(deltaTime);
+  pacman_.Update(deltaTime, grid_, context_, sound_, ghosts_);
+
+  const auto pacmanCell = pacman_.GetCell();
+  const auto headings = steerGhosts();
+  bool killed = false;
+  for (std::size_t i = 0; i < ghosts_.size(); ++i) {
+    auto &ghost = ghosts_[i];
+    const auto from = ghost.GetCell();
+    ghost.Update(deltaTime, grid_, context_, pacman_, blinky(), waveManager_, headings[i]);
+    killed = killed || (ghost.CanKill() && (from == pacmanCell || ghost.GetCell() == pacmanCell));
+  }
+  context_.tick += 1;
+
+  if (!grid_.AnyPelletsLeft()) {
+    return SimulationStatus::kLevelComplete;
+  }
+  return killed ? SimulationStatus::kPacmanKilled : SimulationStatus::kRunning;
+}
+
+auto Simulation::Status() const -> SimulationStatus {
+  if (!grid_.AnyPelletsLeft()) {
+    return SimulationStatus::kLevelComplete;
+  }
+  if (wasKilled()) {
+    return SimulationStatus::kPacmanKilled;
+  }
+  return SimulationStatus::kRunning;
+}
+
+auto Simulation::wasKilled() const -> bool {
+  for (auto &ghost : ghosts_) {
+    if (ghost.CanKill() && (ghost.GetCell() == pacman_.GetCell())) {
+      return true;
+    }
+  }
+  return false;
+}
+
+auto Simulation::Pause() -> void {
+  waveManager_.Pause();
+  pacman_.Pause();
+  for (auto &ghost : ghosts_) {
+    ghost.Pause();
+  }
+}
+
+auto Simulation::Resume() -> void {
+  waveManager_.Resume();
+  pacman_.Resume();
+  for (auto &ghost : ghosts_) {
+    ghost.Resume();
+  }
+}
+
+auto Simulation::Restart() -> void {
+  pacman_.Reset();
+  waveManager_.Reset();
+}
+
+auto Simulation::ResetActors() -> void {
+  pacman_.Reset();
+
+  for (auto &ghost : ghosts_) {
+    ghost.Reset();
+  }
+}
+
+auto Simulation::NextLevel() -> void {
+  grid_.Reset();
+  pacman_.Reset();
+  waveManager_.Reset();
+  context_.NextLevel();
+
+  for (auto &ghost : ghosts_) {
+    ghost.Reset();
+  }
+}
+
+auto Simulation::Resolve(SimulationStatus status) -> bool {
+  switch (status) {
+  case SimulationStatus::kLevelComplete:
+    NextLevel();
+    return false;
+
+  case SimulationStatus::kPacmanKilled:
+    context_.extraLives -= 1;
+    if (context_.extraLives < 0) {
+      return true;
+    }
+    ResetActors();
+    return false;
+
+  default:
+    return false;
+  }
+}
+
+auto Simulation::Snapshot() const -> SimulationSnapshot {
+  SimulationSnapshot snapshot{.context = context_,
+                              .waves = waveManager_.Snapshot(),
+                              .pacman = pacman_.Snapshot(),
+                              .ghosts = {},
+                              .pellets = grid_.Pellets()};
+
+  for (std::size_t i = 0; i < kGhostCount; ++i) {
+    snapshot.ghosts[i] = ghosts_[i].Snapshot();
+  }
+
+  return snapshot;
+}
+
+auto Simulation::Restore(const SimulationSnapshot &snapshot) -> void {
+  context_ = snapshot.context;
+  waveManager_.Restore(snapshot.waves);
+  pacman_.Restore(snapshot.pacman);
+  grid_.RestorePellets(snapshot.pellets);
+
+  for (std::size_t i = 0; i < kGhostCount; ++i) {
+    ghosts_[i].Restore(snapshot.ghosts[i]);
+  }
+}
+
+auto Simulation::NewGame() -> void {
+  grid_.Reset();
+  Restart();
+  context_.Reset();
+
+  for (auto &ghost : ghosts_) {
+    ghost.Reset();
+  }
+}
+
+auto Simulation::LoadMaze(const Grid &grid) -> void {
+  grid_ = grid;
+  NewGame();
+}
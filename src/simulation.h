@@ -0,0 +1,140 @@
+#ifndef SIMULATION_H
+#define SIMULATION_H
+
+#include <array>
+#include <type_traits>
+#include <vector>
+
+#include "constants.h"
+#include "game-context.h"
+#include "ghost-steering.h"
+#include "ghost.h"
+#include "grid.h"
+#include "pacman.h"
+#include "sound-sink.h"
+
+/// Result of advancing the simulation by one step.
+enum class SimulationStatus {
+  kRunning,       ///< Play continues
+  kPacmanKilled,  ///< A ghost that can kill reached Pacman's cell
+  kLevelComplete, ///< Every pellet has been eaten
+};
+
+/// Complete, trivially copyable state of a Simulation. Holds no pointers, so it
+/// can be copied with memcpy, stored in flat arrays or written to disk.
+struct SimulationSnapshot {
+  GameContext context;
+  GhostWaveSnapshot waves;
+  PacmanSnapshot pacman;
+  std::array<GhostSnapshot, kGhostCount> ghosts;
+  PelletBoard pellets;
+
+  auto operator==(const SimulationSnapshot &) const -> bool = default;
+};
+
+static_assert(std::is_trivially_copyable_v<SimulationSnapshot>, "snapshots must be copyable as raw bytes");
+
+/// SDL-free game world: the maze, Pacman, the ghosts, wave timing and scoring.
+/// Game drives it from the SDL loop; headless drivers tick it directly. The
+/// actors are held by value, so a whole world is one contiguous object and
+/// batches of them can live in a single vector.
+class Simulation {
+public:
+  /// Creates the actors on the default maze.
+  /// @param sound Receives sound cues raised during updates
+  explicit Simulation(SoundSink &sound);
+
+  /// Creates the actors on an already loaded maze.
+  /// @param sound Receives sound cues raised during updates
+  /// @param cells Maze layout, as returned by Grid::Load
+  Simulation(SoundSink &sound, const std::vector<std::vector<Cell>> &cells);
+
+  /// Creates the actors on a copy of `grid`, e.g. one built from a LevelPack level.
+  /// @param sound Receives sound cues raised during updates
+  Simulation(SoundSink &sound, const Grid &grid);
+
+  Simulation(const Simulation &) = delete;
+  Simulation &operator=(const Simulation &) = delete;
+  Simulation(Simulation &&) = default;
+
+  /// Forwards the player's requested heading to Pacman.
+  auto ProcessInput(Direction requested) -> void;
+
+  /// Advances the world and reports whether play can continue. Steps of a tick
+  /// or more are split into whole kTickSeconds sub-steps plus any shorter
+  /// remainder, and the step stops at the first sub-step that ends play, so a step
+  /// of N ticks plays out exactly like N Step(kTickSeconds) calls. Fixed-point
+  /// builds run whole ticks only and carry any remainder into the next Step.
+  auto Step(float deltaTime) -> SimulationStatus;
+
+  /// Returns the number of sub-steps Step splits `deltaTime` into, leaving out
+  /// time a fixed-point build carries over from earlier steps.
+  static auto Substeps(float deltaTime) -> int;
+
+  /// Returns the status of the current world without advancing it. Unlike Step,
+  /// this only sees a ghost that shares Pacman's cell right now.
+  auto Status() const -> SimulationStatus;
+
+  /// Freezes wave timing and notifies the actors.
+  auto Pause() -> void;
+
+  /// Resumes wave timing and notifies the actors.
+  auto Resume() -> void;
+
+  /// Returns Pacman and the wave timer to their start (used when a round begins).
+  auto Restart() -> void;
+
+  /// Returns Pacman and the ghosts to their start after Pacman loses a life.
+  auto ResetActors() -> void;
+
+  /// Refills the maze and resets the actors for the next level.
+  auto NextLevel() -> void;
+
+  /// Starts a new game from level one with a full set of lives.
+  auto NewGame() -> void;
+
+  /// Switches to another maze and starts a new game on it.
+  auto LoadMaze(const Grid &grid) -> void;
+
+  /// Applies the outcome of a step without the timed Dying/LevelComplete pauses
+  /// the SDL game shows: a kill costs a life and resets the actors, and a cleared
+  /// maze starts the next level.
+  /// @return true when the kill used up the last life
+  auto Resolve(SimulationStatus status) -> bool;
+
+  /// Captures the whole world. Restoring it later reproduces play exactly.
+  auto Snapshot() const -> SimulationSnapshot;
+
+  /// Rewinds or forks the world to a captured state.
+  auto Restore(const SimulationSnapshot &snapshot) -> void;
+
+  auto GetGrid() const -> const Grid & { return grid_; }
+  auto GetPacman() const -> const Pacman & { return pacman_; }
+  /// Ghosts in Blinky, Inky, Pinky, Clyde order.
+  auto GetGhosts() const -> const std::array<Ghost, kGhostCount> & { return ghosts_; }
+  auto GetContext() -> GameContext & { return context_; }
+  auto GetContext() const -> const GameContext & { return context_; }
+  auto GetWaveManager() -> GhostWaveManager & { return waveManager_; }
+
+private:
+  auto activateGhosts() -> void;
+  auto blinky() -> Ghost & { return ghosts_[0]; }
+  auto steerGhosts() -> std::array<Direction, kGhostCount>;
+  auto substep(float deltaTime) -> SimulationStatus;
+  auto wasKilled() const -> bool;
+
+  SoundSink &sound_;
+
+  Grid grid_{};
+  Pacman pacman_{};
+  std::array<Ghost, kGhostCount> ghosts_{Ghost{BlinkyPersonality{}}, Ghost{InkyPersonality{}},
+                                         Ghost{PinkyPersonality{}}, Ghost{ClydePersonality{}}};
+  GameContext context_{};
+  GhostWaveManager waveManager_{};
+
+  // Scratch lanes for steerGhosts; not part of the world's state. Held inline so a
+  // game owns no heap blocks.
+  FixedSteeringBatch<kGhostCount> steering_{};
+};
+
+#endif
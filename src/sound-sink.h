@@ -0,0 +1,25 @@
+#ifndef SOUND_SINK_H
+#define SOUND_SINK_H
+
+#include <optional>
+
+#include "asset-registry.h"
+
+/// Receives sound cues raised by the simulation so game logic does not depend on SDL_mixer.
+class SoundSink {
+public:
+  virtual ~SoundSink() = default;
+
+  /// Requests playback of a sound effect.
+  /// @param sound The sound effect to play
+  /// @param loop Optional number of times to loop the sound (-1 for infinite)
+  virtual auto Play(Sounds sound, std::optional<int> loop) -> void = 0;
+};
+
+/// Discards all sound cues. Used by headless drivers.
+class NullSoundSink : public SoundSink {
+public:
+  auto Play(Sounds /*sound*/, std::optional<int> /*loop*/) -> void override {}
+};
+
+#endif
@@ -0,0 +1,81 @@
+#include <algorithm>
+#include <climits>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+
+#include "asset-manager.h"
+#include "sprite-atlas.h"
+
+namespace {
+
+constexpr int kAtlasWidth = 384; // fits the widest sheet (the 352 px font)
+constexpr int kPadding = 1;      // transparent texels between sheets, so filtering never bleeds
+
+/// Places `rects` on a kAtlasWidth wide sheet, tallest first, each at the left
+/// of the lowest stretch of the skyline left by those already placed, and
+/// returns the height used. Only the sizes of `rects` are read.
+auto pack(std::span<SDL_Rect, kSpriteCount> rects) -> int {
+  std::array<std::size_t, kSpriteCount> order{};
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&](auto a, auto b) { return rects[a].h > rects[b].h; });
+
+  std::array<int, kAtlasWidth> skyline{};
+  for (auto index : order) {
+    auto &rect = rects[index];
+    if (rect.w > kAtlasWidth) {
+      throw std::runtime_error("Sprite sheet is wider than the atlas");
+    }
+
+    // Columns the sheet and the padding on its right cover when placed at x
+    auto footprint = [&](int x) {
+      auto width = std::min(rect.w + kPadding, kAtlasWidth - x);
+      return std::span{skyline}.subspan(static_cast<std::size_t>(x), static_cast<std::size_t>(width));
+    };
+    rect.y = INT_MAX;
+    for (int x = 0; x + rect.w <= kAtlasWidth; ++x) {
+      auto y = std::ranges::max(footprint(x));
+      if (y < rect.y) {
+        rect.x = x;
+        rect.y = y;
+      }
+    }
+    std::ranges::fill(footprint(rect.x), rect.y + rect.h + kPadding);
+  }
+
+  return std::ranges::max(skyline) - kPadding;
+}
+
+} // namespace
+
+SpriteAtlas::SpriteAtlas(SDL_Renderer *renderer) : width_{kAtlasWidth} {
+  std::array<SDL_Surface *, kSpriteCount> sheets{};
+  for (std::size_t i = 0; i < kSpriteCount; ++i) {
+    sheets[i] = AssetManager::LoadSurface(static_cast<Sprites>(i));
+    regions_[i] = SDL_Rect{0, 0, sheets[i]->w, sheets[i]->h};
+  }
+  height_ = pack(regions_);
+
+  // New surfaces are zero filled, so the padding stays transparent
+  SDL_Surface *atlas = SDL_CreateRGBSurfaceWithFormat(0, width_, height_, 32, SDL_PIXELFORMAT_RGBA32);
+  SDL_assert(atlas != nullptr);
+
+  for (std::size_t i = 0; i < kSpriteCount; ++i) {
+    // Copy alpha as is rather than blending onto the empty atlas
+    SDL_SetSurfaceBlendMode(sheets[i], SDL_BLENDMODE_NONE);
+    auto destination = regions_[i];
+    SDL_BlitSurface(sheets[i], nullptr, atlas, &destination);
+    SDL_FreeSurface(sheets[i]);
+  }
+
+  texture_ = SDL_CreateTextureFromSurface(renderer, atlas);
+  SDL_assert(texture_ != nullptr);
+  SDL_SetTextureBlendMode(texture_, SDL_BLENDMODE_BLEND);
+  SDL_FreeSurface(atlas);
+}
+
+SpriteAtlas::~SpriteAtlas() {
+  if (texture_ != nullptr) {
+    SDL_DestroyTexture(texture_);
+  }
+}
@@ -0,0 +1,36 @@
+#ifndef SPRITE_ATLAS_H
+#define SPRITE_ATLAS_H
+
+#include <array>
+
+#include "SDL.h"
+
+#include "asset-registry.h"
+
+/// Every sprite sheet in Sprites packed into one texture, so everything a frame
+/// draws comes from a single texture and can be submitted in batches (see
+/// SpriteBatch). TextureCache builds and shares it; each sheet is decoded once.
+class SpriteAtlas {
+public:
+  /// Loads and packs every sheet. Aborts, like AssetManager::LoadSurface, if a file cannot be read.
+  explicit SpriteAtlas(SDL_Renderer *renderer);
+  ~SpriteAtlas();
+
+  SpriteAtlas(const SpriteAtlas &) = delete;
+  auto operator=(const SpriteAtlas &) -> SpriteAtlas & = delete;
+
+  auto Texture() const -> SDL_Texture * { return texture_; }
+  auto Width() const -> int { return width_; }
+  auto Height() const -> int { return height_; }
+
+  /// Returns where the sheet for `sprite` lies in the atlas, in texels.
+  auto Region(Sprites sprite) const -> const SDL_Rect & { return regions_[static_cast<std::size_t>(sprite)]; }
+
+private:
+  SDL_Texture *texture_{nullptr};
+  int width_{0};
+  int height_{0};
+  std::array<SDL_Rect, kSpriteCount> regions_{};
+};
+
+#endif
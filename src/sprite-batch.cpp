@@ -0,0 +1,87 @@
+#include "sprite-batch.h"
+
+namespace {
+
+constexpr int kVerticesPerQuad = 4;
+constexpr int kIndicesPerQuad = 6;
+constexpr SDL_Color kOpaqueWhite{255, 255, 255, 255}; // draws texels unmodulated
+
+auto appendQuad(std::vector<SDL_Vertex> &vertices, const SpriteAtlas &atlas, const SDL_Rect &source,
+                const SDL_Rect &destination) -> void {
+  auto texelWidth = 1.0f / static_cast<float>(atlas.Width());
+  auto texelHeight = 1.0f / static_cast<float>(atlas.Height());
+
+  auto left = static_cast<float>(destination.x);
+  auto top = static_cast<float>(destination.y);
+  auto right = static_cast<float>(destination.x + destination.w);
+  auto bottom = static_cast<float>(destination.y + destination.h);
+
+  auto u0 = static_cast<float>(source.x) * texelWidth;
+  auto v0 = static_cast<float>(source.y) * texelHeight;
+  auto u1 = static_cast<float>(source.x + source.w) * texelWidth;
+  auto v1 = static_cast<float>(source.y + source.h) * texelHeight;
+
+  vertices.push_back({{left, top}, kOpaqueWhite, {u0, v0}});
+  vertices.push_back({{right, top}, kOpaqueWhite, {u1, v0}});
+  vertices.push_back({{left, bottom}, kOpaqueWhite, {u0, v1}});
+  vertices.push_back({{right, bottom}, kOpaqueWhite, {u1, v1}});
+}
+
+} // namespace
+
+auto QuadRun::Add(const SpriteAtlas &atlas, const SDL_Rect &source, const SDL_Rect &destination) -> void {
+  SDL_assert(atlas_ == nullptr || atlas_ == &atlas);
+  atlas_ = &atlas;
+  appendQuad(vertices_, atlas, source, destination);
+}
+
+auto QuadRun::Clear() -> void {
+  atlas_ = nullptr;
+  vertices_.clear();
+}
+
+auto SpriteBatch::Draw(RenderLayer layer, const SpriteAtlas &atlas, const SDL_Rect &source,
+                       const SDL_Rect &destination) -> void {
+  useAtlas(atlas);
+  appendQuad(layers_[static_cast<std::size_t>(layer)], atlas, source, destination);
+}
+
+auto SpriteBatch::Draw(RenderLayer layer, const QuadRun &run) -> void {
+  if (run.Empty()) {
+    return;
+  }
+
+  useAtlas(*run.atlas_);
+  auto &vertices = layers_[static_cast<std::size_t>(layer)];
+  vertices.insert(vertices.end(), run.vertices_.begin(), run.vertices_.end());
+}
+
+auto SpriteBatch::Flush(SDL_Renderer *renderer) -> FrameStats {
+  FrameStats stats{.frames = 1};
+
+  for (auto &vertices : layers_) {
+    if (vertices.empty()) {
+      continue;
+    }
+
+    auto quads = static_cast<int>(vertices.size()) / kVerticesPerQuad;
+    for (auto quad = static_cast<int>(indices_.size()) / kIndicesPerQuad; quad < quads; ++quad) {
+      auto first = quad * kVerticesPerQuad;
+      indices_.insert(indices_.end(), {first, first + 1, first + 2, first + 2, first + 1, first + 3});
+    }
+
+    SDL_RenderGeometry(renderer, atlas_->Texture(), vertices.data(), static_cast<int>(vertices.size()),
+                       indices_.data(), quads * kIndicesPerQuad);
+    stats.drawCalls += 1;
+    stats.sprites += static_cast<std::uint64_t>(quads);
+    vertices.clear();
+  }
+
+  atlas_ = nullptr;
+  return stats;
+}
+
+auto SpriteBatch::useAtlas(const SpriteAtlas &atlas) -> void {
+  SDL_assert(atlas_ == nullptr || atlas_ == &atlas);
+  atlas_ = &atlas;
+}
@@ -0,0 +1,83 @@
+#ifndef SPRITE_BATCH_H
+#define SPRITE_BATCH_H
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "SDL.h"
+
+#include "sprite-atlas.h"
+
+/// Draw order of batched sprites. Layers are submitted in this order, so a
+/// sprite on a later layer is drawn over one on an earlier layer whatever order
+/// they were queued in.
+enum class RenderLayer {
+  kBoard,   ///< Maze, score text, lives and fruit
+  kPellets, ///< Regular and power pellets
+  kActors,  ///< Ghosts and Pacman
+};
+
+inline constexpr std::size_t kRenderLayerCount = 3;
+
+/// Rendering work done over `frames` frames.
+struct FrameStats {
+  std::uint64_t frames{0};
+  std::uint64_t drawCalls{0};
+  std::uint64_t sprites{0};
+
+  auto operator+=(const FrameStats &other) -> FrameStats & {
+    frames += other.frames;
+    drawCalls += other.drawCalls;
+    sprites += other.sprites;
+    return *this;
+  }
+};
+
+/// Quads built once and queued whole on later frames, for screen content that
+/// rarely changes, such as the HUD. Keeps its vertices, and their capacity,
+/// until cleared.
+class QuadRun {
+public:
+  /// Appends the texels `source` of `atlas` drawn over `destination`. Every quad
+  /// of a run must come from the same atlas.
+  void Add(const SpriteAtlas &atlas, const SDL_Rect &source, const SDL_Rect &destination);
+
+  void Clear();
+
+  auto Empty() const -> bool { return vertices_.empty(); }
+
+private:
+  friend class SpriteBatch;
+
+  const SpriteAtlas *atlas_{nullptr};
+  std::vector<SDL_Vertex> vertices_;
+};
+
+/// Collects a frame's sprites as textured quads from one SpriteAtlas and submits
+/// each non-empty layer with a single SDL_RenderGeometry call, instead of one
+/// SDL_RenderCopy per sprite. The vertex buffers keep their capacity between
+/// frames, so a steady frame allocates nothing. The batch holds no reference to
+/// the atlas between frames; the sprites drawing from it keep it alive.
+class SpriteBatch {
+public:
+  /// Queues the texels `source` of `atlas` to be drawn over `destination` on
+  /// `layer`. Every sprite of a frame must come from the same atlas.
+  void Draw(RenderLayer layer, const SpriteAtlas &atlas, const SDL_Rect &source, const SDL_Rect &destination);
+
+  /// Queues every quad of `run` on `layer` with one copy of its vertices.
+  void Draw(RenderLayer layer, const QuadRun &run);
+
+  /// Draws and clears every layer.
+  /// @return The draw calls and sprites of this frame
+  auto Flush(SDL_Renderer *renderer) -> FrameStats;
+
+private:
+  void useAtlas(const SpriteAtlas &atlas);
+
+  const SpriteAtlas *atlas_{nullptr}; // atlas of the frame being collected
+  std::array<std::vector<SDL_Vertex>, kRenderLayerCount> layers_;
+  std::vector<int> indices_; // two triangles per quad, shared by every layer
+};
+
+#endif
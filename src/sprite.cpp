@@ -1,50 +1,31 @@
-#include <iostream>
-
-#include "SDL_image.h"
-
-#include "asset-manager.h"
 #include "sprite.h"
 
-Sprite::Sprite(SDL_Renderer *renderer, Sprites sprite) : fps{0}, numFrames{1}, currentFrame{0}, frames{0} {
-  texture = AssetManager::LoadTexture(renderer, sprite);
-  SDL_QueryTexture(texture, nullptr, nullptr, &width, &height);
+Sprite::Sprite(TextureCache &textures, Sprites sprite)
+    : sheet{textures.Acquire(sprite)}, clock{nullptr}, clip{Clip::kStill}, start{0} {
+  width = sheet.region.w;
+  height = sheet.region.h;
   frameWidth = width;
 }
 
-Sprite::Sprite(SDL_Renderer *renderer, Sprites sprite, int fps, int frameWidth) : fps{fps}, currentFrame{0}, frames{0} {
-  texture = AssetManager::LoadTexture(renderer, sprite);
-  SDL_QueryTexture(texture, nullptr, nullptr, &width, &height);
+Sprite::Sprite(TextureCache &textures, Sprites sprite, const AnimationClock &clock, Clip clip, int frameWidth)
+    : sheet{textures.Acquire(sprite)}, clock{&clock}, clip{clip}, start{clock.Seconds()} {
+  width = sheet.region.w;
+  height = sheet.region.h;
   this->frameWidth = frameWidth;
-  numFrames = width / frameWidth;
 }
 
-Sprite::~Sprite() {
-  if (texture != nullptr) {
-    SDL_DestroyTexture(texture);
-  }
-}
+auto Sprite::SetClip(Clip clip) -> void { this->clip = clip; }
 
-auto Sprite::SetFrames(std::vector<int> frames) -> void { this->frames = frames; }
+auto Sprite::Rewind() -> void { start = clock == nullptr ? 0 : clock->Seconds(); }
 
-auto Sprite::Update(const float deltaTime) -> void {
-  if (fps == 0 || frames.size() < 2) {
-    return;
-  }
-
-  currentFrame += fps * deltaTime;
-
-  while (currentFrame >= frames.size()) {
-    currentFrame -= frames.size();
-  }
-}
-
-auto Sprite::Render(SDL_Renderer *renderer, Vec2 destination) -> void {
-  auto frame = static_cast<int>(currentFrame);
+auto Sprite::Render(SpriteBatch &batch, RenderLayer layer, Vec2 destination) -> void {
+  auto elapsed = clock == nullptr ? 0 : clock->Seconds() - start;
+  auto frame = GetClip(clip).FrameAt(elapsed);
 
   SDL_Rect source;
   source.w = frameWidth;
   source.h = height;
-  source.x = frameWidth * frames[frame];
+  source.x = frameWidth * frame;
   source.y = 0;
 
   SDL_Rect destination_;
@@ -53,10 +34,16 @@ auto Sprite::Render(SDL_Renderer *renderer, Vec2 destination) -> void {
   destination_.x = destination.x;
   destination_.y = destination.y;
 
-  Render(renderer, source, destination_);
-  // SDL_RenderCopy(renderer, texture, &source, &destination);
+  Render(batch, layer, source, destination_);
+}
+
+auto Sprite::Render(SpriteBatch &batch, RenderLayer layer, const SDL_Rect &source, const SDL_Rect &destination)
+    -> void {
+  SDL_Rect texels{sheet.region.x + source.x, sheet.region.y + source.y, source.w, source.h};
+  batch.Draw(layer, *sheet.atlas, texels, destination);
 }
 
-auto Sprite::Render(SDL_Renderer *renderer, const SDL_Rect &source, const SDL_Rect &destination) -> void {
-  SDL_RenderCopy(renderer, texture, &source, &destination);
+auto Sprite::Render(QuadRun &run, const SDL_Rect &source, const SDL_Rect &destination) -> void {
+  SDL_Rect texels{sheet.region.x + source.x, sheet.region.y + source.y, source.w, source.h};
+  run.Add(*sheet.atlas, texels, destination);
 }
@@ -2,36 +2,51 @@
 #define SPRITE_H
 
 #include <string>
-#include <vector>
 
 #include "SDL.h"
 
+#include "animation.h"
 #include "asset-registry.h"
+#include "sprite-batch.h"
+#include "texture-cache.h"
 #include "vector2.h"
 
+/// A view of one sprite sheet, still or playing an animation clip. Holds a
+/// shared handle to the sheet's texture from a TextureCache, so sprites are cheap
+/// to create and copy; drawing queues a quad on a SpriteBatch. An animated sprite
+/// works out its frame from an AnimationClock when drawn and has no update step.
 class Sprite {
 public:
-  Sprite(SDL_Renderer *renderer, Sprites sprite);
-  Sprite(SDL_Renderer *renderer, Sprites sprite, int fps, int frameWidth);
+  /// A still sprite covering the whole sheet.
+  Sprite(TextureCache &textures, Sprites sprite);
 
-  // TODO implement rule of 5
-  ~Sprite();
+  /// A sprite playing `clip` on `clock`, from a sheet of `frameWidth` wide frames.
+  /// The clock must outlive the sprite.
+  Sprite(TextureCache &textures, Sprites sprite, const AnimationClock &clock, Clip clip, int frameWidth);
 
-  void Update(const float deltaTime);
-  void Render(SDL_Renderer *renderer, Vec2 destination);
-  void Render(SDL_Renderer *renderer, const SDL_Rect &source, const SDL_Rect &destination);
+  /// Queues the current frame with its top left corner at `destination`.
+  void Render(SpriteBatch &batch, RenderLayer layer, Vec2 destination);
 
-  void SetFrames(std::vector<int> frames);
+  /// Queues the part `source` of the sheet, in sheet coordinates, over `destination`.
+  void Render(SpriteBatch &batch, RenderLayer layer, const SDL_Rect &source, const SDL_Rect &destination);
+
+  /// Appends the part `source` of the sheet, in sheet coordinates, over `destination` to `run`.
+  void Render(QuadRun &run, const SDL_Rect &source, const SDL_Rect &destination);
+
+  /// Switches to `clip`, keeping the animation's phase.
+  void SetClip(Clip clip);
+
+  /// Restarts the clip from its first frame.
+  void Rewind();
 
 private:
-  SDL_Texture *texture;
-  int fps;
-  int numFrames;
+  SpriteTexture sheet;
+  const AnimationClock *clock;
+  Clip clip;
+  double start; // clock time the clip started
   int width;
   int height;
   int frameWidth;
-  float currentFrame;
-  std::vector<int> frames;
 };
 
-#endif
\ No newline at end of file
+#endif
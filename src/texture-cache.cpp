@@ -0,0 +1,38 @@
+#include <algorithm>
+
+#include "texture-cache.h"
+
+namespace {
+
+constexpr std::size_t kBytesPerTexel = 4;
+
+auto textureBytes(const SpriteAtlas &atlas) -> std::size_t {
+  return static_cast<std::size_t>(atlas.Width()) * static_cast<std::size_t>(atlas.Height()) * kBytesPerTexel;
+}
+
+} // namespace
+
+TextureCache::TextureCache(SDL_Renderer *renderer)
+    : renderer_{renderer}, stats_{std::make_shared<TextureStats>()} {}
+
+auto TextureCache::Acquire(Sprites sprite) -> SpriteTexture {
+  auto atlas = atlas_.lock();
+  if (atlas == nullptr) {
+    atlas = std::shared_ptr<const SpriteAtlas>{new SpriteAtlas{renderer_}, [stats = stats_](const SpriteAtlas *atlas) {
+                                                 stats->textures -= 1;
+                                                 stats->bytes -= textureBytes(*atlas);
+                                                 delete atlas;
+                                               }};
+    atlas_ = atlas;
+
+    stats_->decodes += kSpriteCount;
+    stats_->uploads += 1;
+    stats_->textures += 1;
+    stats_->bytes += textureBytes(*atlas);
+    stats_->peakBytes = std::max(stats_->peakBytes, stats_->bytes);
+  }
+
+  stats_->acquires += 1;
+  auto region = atlas->Region(sprite);
+  return {.atlas = std::move(atlas), .region = region};
+}
@@ -0,0 +1,52 @@
+#ifndef TEXTURE_CACHE_H
+#define TEXTURE_CACHE_H
+
+#include <cstddef>
+#include <memory>
+
+#include "SDL.h"
+
+#include "asset-registry.h"
+#include "sprite-atlas.h"
+
+/// Texture memory and loading work of a TextureCache.
+struct TextureStats {
+  std::size_t decodes{0};   ///< Sprite sheets decoded from disk
+  std::size_t uploads{0};   ///< Textures created
+  std::size_t acquires{0};  ///< Handles handed out
+  std::size_t textures{0};  ///< Textures alive
+  std::size_t bytes{0};     ///< Texture memory alive, at 4 bytes a texel
+  std::size_t peakBytes{0}; ///< Most texture memory alive at once
+};
+
+/// Shared handle to one sprite sheet: the atlas texture that holds it and where
+/// it lies there. The texture stays alive while any handle to it does.
+struct SpriteTexture {
+  std::shared_ptr<const SpriteAtlas> atlas;
+  SDL_Rect region;
+};
+
+/// Sprite textures of one renderer, keyed by Sprites. The first Acquire decodes
+/// every sheet once and uploads them as a single SpriteAtlas, and every later
+/// Acquire shares it, so no sheet is decoded or held in video memory twice. The
+/// texture is destroyed with its last handle and rebuilt by the next Acquire.
+class TextureCache {
+public:
+  explicit TextureCache(SDL_Renderer *renderer);
+
+  TextureCache(const TextureCache &) = delete;
+  auto operator=(const TextureCache &) -> TextureCache & = delete;
+
+  /// Returns a shared handle to the sheet for `sprite`.
+  auto Acquire(Sprites sprite) -> SpriteTexture;
+
+  auto Stats() const -> const TextureStats & { return *stats_; }
+
+private:
+  SDL_Renderer *renderer_;
+  std::weak_ptr<const SpriteAtlas> atlas_;
+  // Shared with the deleter of the live atlas, which may outlive the cache
+  std::shared_ptr<TextureStats> stats_;
+};
+
+#endif
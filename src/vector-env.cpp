@@ -0,0 +1,127 @@
+#include <algorithm>
+#include <stdexcept>
+
+#include "vector-env.h"
+
+// Environments never play audio; the sink is stateless so all games share it.
+static NullSoundSink Silence;
+
+namespace {
+
+constexpr float kMazeWidth = static_cast<float>(kGridWidth * kCellSize);
+constexpr float kMazeHeight = static_cast<float>(kGridHeight * kCellSize);
+
+constexpr auto feature(ObservationFeature feature) -> std::size_t { return static_cast<std::size_t>(feature); }
+
+constexpr auto feature(std::size_t ghost, GhostFeature feature) -> std::size_t {
+  return static_cast<std::size_t>(ObservationFeature::kGhosts) +
+         ghost * static_cast<std::size_t>(GhostFeature::kCount) + static_cast<std::size_t>(feature);
+}
+
+auto toDirection(std::int32_t action) -> Direction {
+  if (action < 0 || action > static_cast<std::int32_t>(Direction::kWest)) {
+    return Direction::kNeutral;
+  }
+  return static_cast<Direction>(action);
+}
+
+} // namespace
+
+VectorEnv::VectorEnv(std::size_t envs, const Grid &grid, int frameSkip, std::size_t threads, int tickRate)
+    : frameSkip_{frameSkip}, deltaTime_{1.0f / static_cast<float>(tickRate)}, pool_{threads},
+      stepRange_{[this](std::size_t begin, std::size_t end) { stepRange(begin, end); }} {
+  if (frameSkip < 1 || tickRate < 1) {
+    throw std::invalid_argument("frame skip and tick rate must be positive");
+  }
+
+  games_.reserve(envs);
+  for (std::size_t i = 0; i < envs; ++i) {
+    games_.emplace_back(Silence, grid);
+  }
+}
+
+auto VectorEnv::Reset(std::size_t env) -> void { games_.at(env).NewGame(); }
+
+auto VectorEnv::Step(std::span<const std::int32_t> actions, std::span<float> observations, std::span<float> rewards,
+                     std::span<std::uint8_t> dones) -> void {
+  if (actions.size() != Size() || observations.size() != Size() * kObservationSize || rewards.size() != Size() ||
+      dones.size() != Size()) {
+    throw std::invalid_argument("VectorEnv::Step buffers must hold one entry per environment");
+  }
+
+  actions_ = actions;
+  observations_ = observations;
+  rewards_ = rewards;
+  dones_ = dones;
+
+  pool_.ParallelFor(Size(), kGrain, stepRange_);
+}
+
+auto VectorEnv::Observe(std::span<float> observations) const -> void {
+  if (observations.size() != Size() * kObservationSize) {
+    throw std::invalid_argument("VectorEnv::Observe buffer must hold one observation per environment");
+  }
+
+  for (std::size_t env = 0; env < Size(); ++env) {
+    observe(env, observations.data() + env * kObservationSize);
+  }
+}
+
+auto VectorEnv::ObservePlanes(const ObservationEncoder &encoder, std::span<std::uint8_t> planes) const -> void {
+  if (planes.size() != Size() * encoder.Bytes()) {
+    throw std::invalid_argument("VectorEnv::ObservePlanes buffer must hold one encoding per environment");
+  }
+
+  for (std::size_t env = 0; env < Size(); ++env) {
+    encoder.Encode(games_[env], planes.subspan(env * encoder.Bytes(), encoder.Bytes()));
+  }
+}
+
+auto VectorEnv::stepRange(std::size_t begin, std::size_t end) -> void {
+  for (auto env = begin; env < end; ++env) {
+    auto &simulation = games_[env];
+    const auto scoreBefore = simulation.GetContext().score;
+
+    simulation.ProcessInput(toDirection(actions_[env]));
+
+    bool done = false;
+    for (int tick = 0; tick < frameSkip_ && !done; ++tick) {
+      done = simulation.Resolve(simulation.Step(deltaTime_));
+    }
+
+    rewards_[env] = static_cast<float>(simulation.GetContext().score - scoreBefore);
+    dones_[env] = done ? 1 : 0;
+
+    if (done) {
+      simulation.NewGame();
+    }
+
+    observe(env, observations_.data() + env * kObservationSize);
+  }
+}
+
+auto VectorEnv::observe(std::size_t env, float *out) const -> void {
+  const auto &simulation = games_[env];
+  const auto &pacman = simulation.GetPacman();
+  const auto &context = simulation.GetContext();
+
+  out[feature(ObservationFeature::kPacmanX)] = pacman.GetPosition().x / kMazeWidth;
+  out[feature(ObservationFeature::kPacmanY)] = pacman.GetPosition().y / kMazeHeight;
+  out[feature(ObservationFeature::kEnergized)] = pacman.GetEnergizedFor() / kEnergizerDuration;
+
+  const auto &ghosts = simulation.GetGhosts();
+  for (std::size_t i = 0; i < kGhostCount; ++i) {
+    const auto &ghost = ghosts[i];
+    out[feature(i, GhostFeature::kX)] = ghost.GetPosition().x / kMazeWidth;
+    out[feature(i, GhostFeature::kY)] = ghost.GetPosition().y / kMazeHeight;
+    out[feature(i, GhostFeature::kScared)] = ghost.IsScared() ? 1.0f : 0.0f;
+    out[feature(i, GhostFeature::kRespawning)] = ghost.IsRespawning() ? 1.0f : 0.0f;
+  }
+
+  // A fraction of the maze's own pellets, so level pack mazes of any size read the same
+  const auto &grid = simulation.GetGrid();
+  out[feature(ObservationFeature::kPelletsLeft)] =
+      static_cast<float>(grid.PelletsLeft()) / static_cast<float>(std::max<std::size_t>(grid.InitialPelletCount(), 1));
+  out[feature(ObservationFeature::kExtraLives)] = static_cast<float>(context.extraLives);
+  out[feature(ObservationFeature::kLevel)] = static_cast<float>(context.level);
+}
@@ -0,0 +1,95 @@
+#ifndef VECTOR_ENV_H
+#define VECTOR_ENV_H
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "constants.h"
+#include "grid.h"
+#include "observation-encoder.h"
+#include "simulation.h"
+#include "work-stealing-pool.h"
+
+/// Layout of each ghost's block in a feature observation.
+enum class GhostFeature : std::size_t { kX = 0, kY, kScared, kRespawning, kCount };
+
+/// Layout of one environment's feature observation. Positions are normalised to
+/// [0, 1] over the maze; flags are 0 or 1.
+enum class ObservationFeature : std::size_t {
+  kPacmanX = 0,
+  kPacmanY,
+  kEnergized, ///< Remaining energizer time as a fraction of kEnergizerDuration
+  kGhosts,    ///< kGhostCount blocks of GhostFeature, Blinky, Inky, Pinky, Clyde
+  /// Pellets left as a fraction of those the maze started with
+  kPelletsLeft = kGhosts + static_cast<std::size_t>(GhostFeature::kCount) * kGhostCount,
+  kExtraLives,
+  kLevel,
+  kCount,
+};
+
+/// Batch of independent games for reinforcement learning. Each Step applies one
+/// action per game for `frameSkip` ticks, then writes observations, rewards (score
+/// gained) and done flags straight into caller buffers. Finished games restart at
+/// once, so the observation after a done is the first of the next episode.
+/// Buffers are validated but never allocated, and the batching itself performs no
+/// heap allocation per step.
+class VectorEnv {
+public:
+  static constexpr std::size_t kObservationSize = static_cast<std::size_t>(ObservationFeature::kCount);
+
+  /// @param envs Number of games
+  /// @param grid Maze every game is played on, e.g. Grid{kDefaultMaze}
+  /// @param frameSkip Ticks each action is repeated for; throws std::invalid_argument if < 1
+  /// @param threads Worker threads including the caller; 0 uses the hardware concurrency
+  /// @param tickRate Simulation ticks per second of game time
+  VectorEnv(std::size_t envs, const Grid &grid, int frameSkip = 4, std::size_t threads = 0,
+            int tickRate = static_cast<int>(kFramesPerSecond));
+
+  VectorEnv(const VectorEnv &) = delete;
+  VectorEnv &operator=(const VectorEnv &) = delete;
+
+  /// Starts a new game in environment `env`.
+  auto Reset(std::size_t env) -> void;
+
+  /// Advances every environment. Actions are Direction values (0 keeps the current
+  /// heading); anything else is treated as 0.
+  /// @param actions Size() actions
+  /// @param observations Size() * kObservationSize floats
+  /// @param rewards Size() floats
+  /// @param dones Size() flags, 1 where the game ended during this step
+  auto Step(std::span<const std::int32_t> actions, std::span<float> observations, std::span<float> rewards,
+            std::span<std::uint8_t> dones) -> void;
+
+  /// Writes the current observation of every environment.
+  auto Observe(std::span<float> observations) const -> void;
+
+  /// Writes every environment's planes back to back, encoder.Bytes() per environment.
+  auto ObservePlanes(const ObservationEncoder &encoder, std::span<std::uint8_t> planes) const -> void;
+
+  auto Size() const -> std::size_t { return games_.size(); }
+  auto FrameSkip() const -> int { return frameSkip_; }
+  auto GetSimulation(std::size_t env) const -> const Simulation & { return games_.at(env); }
+
+private:
+  auto stepRange(std::size_t begin, std::size_t end) -> void;
+  auto observe(std::size_t env, float *out) const -> void;
+
+  /// Environments per chunk handed to the pool.
+  static constexpr std::size_t kGrain = 16;
+
+  std::vector<Simulation> games_; // contiguous, one per environment
+  int frameSkip_;
+  float deltaTime_;
+
+  WorkStealingPool pool_;
+  WorkStealingPool::RangeFunction stepRange_; // built once so Step does not allocate
+
+  // Buffers of the Step call in progress
+  std::span<const std::int32_t> actions_;
+  std::span<float> observations_;
+  std::span<float> rewards_;
+  std::span<std::uint8_t> dones_;
+};
+
+#endif
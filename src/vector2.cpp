@@ -43,5 +43,8 @@ auto Vec2::operator*(const float &rhs) const -> Vec2 { return {x * rhs, y * rhs}
 // Checks two vectors for equality
 auto operator==(const Vec2 &lhs, const Vec2 &rhs) -> bool { return lhs.x == rhs.x && lhs.y == rhs.y; };
 
+// Linearly interpolates from one vector to another.
+auto Lerp(const Vec2 &from, const Vec2 &to, float t) -> Vec2 { return from + (to - from) * t; }
+
 // Computes floor of all vector components.
 auto Vec2::Floor() const -> Vec2 { return {std::floor(x), std::floor(y)}; }
@@ -35,4 +35,6 @@ struct Vec2Hash {
 
 auto operator==(const Vec2 &lhs, const Vec2 &rhs) -> bool;
 
+auto Lerp(const Vec2 &from, const Vec2 &to, float t) -> Vec2;
+
 #endif
@@ -0,0 +1,149 @@
+#include <algorithm>
+#include <optional>
+
+#include "work-stealing-pool.h"
+
+WorkStealingPool::WorkStealingPool(std::size_t threads) {
+  if (threads == 0) {
+    threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+
+  for (std::size_t i = 0; i < threads; ++i) {
+    queues_.push_back(std::make_unique<Queue>());
+  }
+
+  // Queue 0 is drained by the thread calling ParallelFor
+  for (std::size_t i = 1; i < threads; ++i) {
+    threads_.emplace_back(&WorkStealingPool::workerLoop, this, i);
+  }
+}
+
+WorkStealingPool::~WorkStealingPool() {
+  {
+    std::lock_guard<std::mutex> lock(wakeMutex_);
+    stopping_ = true;
+  }
+
+  wake_.notify_all();
+
+  for (auto &thread : threads_) {
+    if (thread.joinable()) {
+      thread.join();
+    }
+  }
+}
+
+auto WorkStealingPool::ParallelFor(std::size_t count, std::size_t grain, const RangeFunction &fn) -> void {
+  if (count == 0) {
+    return;
+  }
+
+  grain = std::max<std::size_t>(grain, 1);
+  const auto chunks = (count + grain - 1) / grain;
+  Call call{.fn = &fn, .remaining = chunks, .failed = false, .error = nullptr};
+
+  // Count the chunks before publishing them so a fast thief never drives pending_ below zero
+  {
+    std::lock_guard<std::mutex> lock(wakeMutex_);
+    pending_ += chunks;
+  }
+
+  // Deal chunks round-robin so every worker starts with local work
+  for (std::size_t chunk = 0; chunk < chunks; ++chunk) {
+    auto begin = chunk * grain;
+    auto &queue = *queues_[chunk % queues_.size()];
+
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    queue.tasks.push_back(Task{&call, begin, std::min(begin + grain, count)});
+  }
+
+  wake_.notify_all();
+
+  // Help out until every chunk of this call has finished; only then may `call` leave scope
+  while (call.remaining.load(std::memory_order_acquire) > 0) {
+    if (!runOne(0)) {
+      std::this_thread::yield();
+    }
+  }
+
+  if (call.error) {
+    std::rethrow_exception(call.error);
+  }
+}
+
+auto WorkStealingPool::workerLoop(std::size_t index) -> void {
+  while (true) {
+    if (runOne(index)) {
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock(wakeMutex_);
+    wake_.wait(lock, [this]() { return pending_.load() > 0 || stopping_; });
+
+    if (stopping_) {
+      return;
+    }
+  }
+}
+
+auto WorkStealingPool::runOne(std::size_t index) -> bool {
+  std::optional<Task> task;
+
+  // Own queue first, newest chunk (still warm in cache)
+  {
+    auto &own = *queues_[index];
+    std::lock_guard<std::mutex> lock(own.mutex);
+    if (!own.Empty()) {
+      task = own.PopBack();
+    }
+  }
+
+  // Otherwise steal the oldest chunk from another queue
+  for (std::size_t offset = 1; !task && offset < queues_.size(); ++offset) {
+    auto &victim = *queues_[(index + offset) % queues_.size()];
+    std::lock_guard<std::mutex> lock(victim.mutex);
+    if (!victim.Empty()) {
+      task = victim.PopFront();
+    }
+  }
+
+  if (!task) {
+    return false;
+  }
+
+  pending_.fetch_sub(1);
+
+  // Once a chunk has failed the rest are only drained, so the caller rethrows sooner
+  auto &call = *task->call;
+  if (!call.failed.load(std::memory_order_relaxed)) {
+    try {
+      (*call.fn)(task->begin, task->end);
+    } catch (...) {
+      if (!call.failed.exchange(true)) {
+        call.error = std::current_exception();
+      }
+    }
+  }
+  call.remaining.fetch_sub(1, std::memory_order_release);
+
+  return true;
+}
+
+auto WorkStealingPool::Queue::PopBack() -> Task {
+  auto task = tasks.back();
+  tasks.pop_back();
+  if (Empty()) {
+    tasks.clear();
+    head = 0;
+  }
+  return task;
+}
+
+auto WorkStealingPool::Queue::PopFront() -> Task {
+  auto task = tasks[head++];
+  if (Empty()) {
+    tasks.clear();
+    head = 0;
+  }
+  return task;
+}
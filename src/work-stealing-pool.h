@@ -0,0 +1,112 @@
+#ifndef WORK_STEALING_POOL_H
+#define WORK_STEALING_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Fixed-size thread pool that splits index ranges into chunks and balances them by work stealing.
+ *
+ * Each worker owns a deque of chunks. A worker pops from the back of its own deque and, when that is empty,
+ * steals from the front of another worker's deque, so threads that finish early pick up the slack of
+ * slower ones. The thread calling ParallelFor also runs chunks while it waits.
+ */
+class WorkStealingPool {
+public:
+  using RangeFunction = std::function<void(std::size_t begin, std::size_t end)>;
+
+  /**
+   * @brief Starts the worker threads.
+   *
+   * @param threads Total number of threads, including the caller of ParallelFor. 0 uses the hardware concurrency.
+   */
+  explicit WorkStealingPool(std::size_t threads = 0);
+
+  /**
+   * @brief Stops and joins the worker threads.
+   */
+  ~WorkStealingPool();
+
+  WorkStealingPool(const WorkStealingPool &) = delete;
+  WorkStealingPool &operator=(const WorkStealingPool &) = delete;
+
+  /**
+   * @brief Runs `fn` over [0, count) in chunks of at most `grain` indices and blocks until all chunks finish.
+   *
+   * @param count Number of indices
+   * @param grain Maximum chunk size
+   * @param fn Called with each chunk's half-open range; must be safe to call concurrently on disjoint ranges
+   * @throws The first exception `fn` threw, rethrown on the caller once every chunk has finished or been
+   * skipped. Chunks not yet started when `fn` throws are skipped.
+   */
+  auto ParallelFor(std::size_t count, std::size_t grain, const RangeFunction &fn) -> void;
+
+  /**
+   * @brief Returns the number of threads that run chunks, including the caller.
+   */
+  auto Size() const -> std::size_t { return queues_.size(); }
+
+private:
+  /**
+   * @brief State of one ParallelFor call, shared by its chunks. Lives on the caller's stack, which
+   * ParallelFor does not leave until `remaining` reaches zero.
+   */
+  struct Call {
+    const RangeFunction *fn;             ///< Function to run
+    std::atomic<std::size_t> remaining;  ///< Chunks still queued or running
+    std::atomic<bool> failed{false};     ///< Set by the first chunk whose `fn` threw
+    std::exception_ptr error;            ///< That exception; written only by the chunk that set `failed`
+  };
+
+  /**
+   * @brief A chunk of a ParallelFor call.
+   */
+  struct Task {
+    Call *call;        ///< Call the chunk belongs to
+    std::size_t begin; ///< First index
+    std::size_t end;   ///< One past the last index
+  };
+
+  /**
+   * @brief A worker's task deque. Chunks live in tasks[head, size); the storage is reused once
+   * the deque drains, so steady-state ParallelFor calls do not allocate.
+   */
+  struct Queue {
+    std::vector<Task> tasks; ///< Pending chunks, oldest first
+    std::size_t head{0};     ///< Index of the oldest pending chunk
+    std::mutex mutex;        ///< Deque access protection
+
+    auto Empty() const -> bool { return head == tasks.size(); }
+    auto PopBack() -> Task;
+    auto PopFront() -> Task;
+  };
+
+  /**
+   * @brief Main function of worker `index`.
+   */
+  auto workerLoop(std::size_t index) -> void;
+
+  /**
+   * @brief Runs one chunk from queue `index`, or stolen from another queue. Never throws: an exception
+   * from the chunk is stored in its Call.
+   *
+   * @return false if every queue was empty
+   */
+  auto runOne(std::size_t index) -> bool;
+
+  std::vector<std::unique_ptr<Queue>> queues_; ///< One deque per thread; slot 0 belongs to the caller
+  std::vector<std::thread> threads_;           ///< Worker threads (queues 1..n)
+  std::atomic<std::size_t> pending_{0};        ///< Chunks queued but not yet taken
+  std::mutex wakeMutex_;                       ///< Sleep/wake protection
+  std::condition_variable wake_;               ///< New work or shutdown notification
+  bool stopping_{false};                       ///< Shutdown flag
+};
+
+#endif